@@ -0,0 +1,329 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           bench.c
+** Last modified Date:  2026-10-19
+** Last Version:        V1.00
+** Descriptions:        Benchmarks of the Quoridor game logic on a Cortex-M3 (QEMU mps2-an385).
+**                      QEMU runs with -icount shift=BENCH_ICOUNT_SHIFT, so every guest instruction
+**                      advances the virtual clock by 2^shift ns and the 25 MHz CMSDK timer becomes
+**                      an instruction counter. Cycles are estimated from the instruction count with
+**                      the average CPI of the LPC1768 running from flash at 100 MHz.
+** Correlated files:    ../src/quoridor.c, stubs.c, startup_mps2.c
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "quoridor.h"
+#include "profile/profile.h"
+#include "record/record.h"
+#include "mps2.h"
+
+#ifndef BENCH_ICOUNT_SHIFT
+#define BENCH_ICOUNT_SHIFT  0
+#endif
+#ifndef BENCH_CPI_X100
+#define BENCH_CPI_X100      135           /* average cycles per instruction x100 (flash accelerator, 4 WS) */
+#endif
+#ifndef BENCH_DEPTH
+#define BENCH_DEPTH         2             /* fixed depth of the move tree walk                             */
+#endif
+#define BENCH_CCLK_MHZ      100
+
+#define MAX_MOVES           (4 + 2*6*6)   /* token steps + wall slots */
+#define RECORD_PLIES        60            /* length of the recorded game                                   */
+
+static Game game;                         /* position under test, separate from the firmware's */
+static volatile uint32_t sink;
+static Game start;                        /* starting position of the recorded game */
+static Move played[RECORD_PLIES];
+static uint8_t winner;                    /* of the recorded game, or RECORD_NO_WINNER */
+static uint8_t recordBuf[RECORD_HEADER + 2 * RECORD_PLIES + 2];
+
+/******************************************************************************
+** Function name:		report
+**
+** Descriptions:		Converts timer ticks measured over reps calls into instructions
+**									and estimated cycles per call and prints one line.
+**
+** parameters:			benchmark name, timer ticks, repetitions
+** Returned value:		None
+**
+******************************************************************************/
+static void report(const char *name, uint32_t ticks, uint32_t reps){
+	uint64_t insns = ((uint64_t)ticks * (1000000000ULL / MPS2_TIMER_HZ)) >> BENCH_ICOUNT_SHIFT;
+	uint64_t perCall = insns / reps;
+	uint64_t cycles = perCall * BENCH_CPI_X100 / 100;
+
+	printf("%-28s %8lu %12lu %12lu %10lu\n", name, (unsigned long)reps, (unsigned long)perCall,
+	       (unsigned long)cycles, (unsigned long)(cycles / BENCH_CCLK_MHZ));
+}
+
+/******************************************************************************
+** Function name:		bench_cycles
+**
+** Descriptions:		Virtual cycle counter of the profiling zones (PROFILE_COUNTER):
+**									the instruction count of the timer scaled by the average CPI.
+**
+** parameters:			None
+** Returned value:		estimated cycles since timer_start
+**
+******************************************************************************/
+uint32_t bench_cycles(void){
+	uint64_t insns = ((uint64_t)timer_read() * (1000000000ULL / MPS2_TIMER_HZ)) >> BENCH_ICOUNT_SHIFT;
+
+	return (uint32_t)(insns * BENCH_CPI_X100 / 100);
+}
+
+/******************************************************************************
+** Function name:		placeWall
+**
+** Descriptions:		Inserts a committed wall in the game, as executeMove does on
+**									confirmation (removeWall takes it back). Game logic only: the
+**									wall is not drawn, so the timed tree walk measures no rendering.
+**
+******************************************************************************/
+static void placeWall(uint8_t x, uint8_t y, uint8_t orientation){
+	insertWall(&game, x, y, orientation);
+}
+
+/******************************************************************************
+** Function name:		setupPosition
+**
+** Descriptions:		Middle-game position: both tokens advanced and six walls placed.
+**
+******************************************************************************/
+static void setupPosition(void){
+	initGame(&game);
+	placeWall(3, 2, 1);
+	placeWall(3, 5, 1);
+	placeWall(2, 4, 0);
+	placeWall(5, 2, 0);
+	placeWall(4, 6, 1);
+	placeWall(1, 3, 1);
+	game.player[0].walls = 5;
+	game.player[1].walls = 5;
+	updatePlayerState(&game, 0, 4, 3, false);
+	updatePlayerState(&game, 1, 2, 2, false);
+	game.activePlayer = 0;
+}
+
+/******************************************************************************
+** Function name:		genMoves
+**
+** Descriptions:		Move generator built on the game rules: token steps from the
+**									Direction computed by updatePlayerState (target from squareStep
+**									or squareJump) and every wall slot that passes checkWallPosition
+**									and checkTrap.
+**
+** parameters:			output list (may be NULL)
+** Returned value:		number of legal moves
+**
+******************************************************************************/
+static int genMoves(Move *list){
+	Player *p = &game.player[game.activePlayer];
+	Move m;
+	int n = 0;
+	uint8_t x, y, o, step, kind, target;
+
+	m.word32 = 0;
+	m.bits.playerID = game.activePlayer;
+	for (step = 0; step < STEPS; step++) {
+		kind = (p->direction.word8 >> (2 * step)) & 3;
+		if (kind == 0) continue;
+		target = (kind == 1 ? squareStep : squareJump)[SQUARE(p->x, p->y)][step];
+		m.bits.x = squareRow[target]; m.bits.y = squareColumn[target];
+		if (list) list[n] = m;
+		n++;
+	}
+
+	if (p->walls == 0) return n;
+	m.bits.move = 1;
+	for (o = 0; o < 2; o++) {
+		for (x = 1; x < 7; x++) {
+			for (y = 1; y < 7; y++) {
+				if (checkWallPosition(&game, x, y, o) && checkTrap(&game, x, y, o)) {
+					m.bits.x = x; m.bits.y = y; m.bits.orientation = o;
+					if (list) list[n] = m;
+					n++;
+				}
+			}
+		}
+	}
+	return n;
+}
+
+/******************************************************************************
+** Function name:		perft
+**
+** Descriptions:		Fixed-depth walk of the move tree (make, recurse, unmake), the
+**									workload of a search engine without evaluation.
+**
+** parameters:			remaining depth
+** Returned value:		number of leaf nodes
+**
+******************************************************************************/
+static uint32_t perft(int depth){
+	Move list[MAX_MOVES];
+	uint32_t nodes = 0;
+	uint8_t id = game.activePlayer, oldX, oldY;
+	int i, n;
+
+	n = genMoves(list);
+	if (depth <= 1) return n;
+
+	for (i = 0; i < n; i++) {
+		oldX = game.player[id].x; oldY = game.player[id].y;
+		if (list[i].bits.move == 0) {
+			updatePlayerState(&game, id, list[i].bits.x, list[i].bits.y, false);
+		} else {
+			placeWall(list[i].bits.x, list[i].bits.y, list[i].bits.orientation);
+			game.player[id].walls--;
+		}
+		game.activePlayer = !id;
+		updatePlayerState(&game, 0, game.player[0].x, game.player[0].y, false);
+		updatePlayerState(&game, 1, game.player[1].x, game.player[1].y, false);
+
+		nodes += perft(depth - 1);
+
+		game.activePlayer = id;
+		if (list[i].bits.move == 0) {
+			updatePlayerState(&game, id, oldX, oldY, false);
+		} else {
+			removeWall(&game, list[i].bits.x, list[i].bits.y, list[i].bits.orientation);
+			game.player[id].walls++;
+		}
+		updatePlayerState(&game, 0, game.player[0].x, game.player[0].y, false);
+		updatePlayerState(&game, 1, game.player[1].x, game.player[1].y, false);
+	}
+	return nodes;
+}
+
+/******************************************************************************
+** Function name:		recordGame
+**
+** Descriptions:		Plays a game from the starting position, picking a spread of the
+**									legal moves, and records it (record_move) as the firmware does.
+**									The moves are kept in played, the winner in winner.
+**
+** parameters:			writer
+** Returned value:		number of moves played
+**
+******************************************************************************/
+static int recordGame(RecordWriter *w){
+	Move list[MAX_MOVES];
+	uint8_t id;
+	int ply, n;
+
+	winner = RECORD_NO_WINNER;
+	initGame(&game);
+	updatePlayerState(&game, 0, game.player[0].x, game.player[0].y, false);
+	updatePlayerState(&game, 1, game.player[1].x, game.player[1].y, false);
+	start = game;
+	record_begin(w, recordBuf, sizeof(recordBuf), RECORD_TIMES, &start);
+	for (ply = 0; ply < RECORD_PLIES; ply++) {
+		id = game.activePlayer;
+		n = genMoves(list);
+		played[ply] = list[(ply * 7) % n];
+		record_move(w, played[ply], ply * 250);
+		if (played[ply].bits.move == 0) {
+			updatePlayerState(&game, id, played[ply].bits.x, played[ply].bits.y, false);
+			if (game.player[id].x == game.player[id].finalX) { winner = id; ply++; break; }
+		} else {
+			placeWall(played[ply].bits.x, played[ply].bits.y, played[ply].bits.orientation);
+			game.player[id].walls--;
+		}
+		game.activePlayer = !id;
+		updatePlayerState(&game, 0, game.player[0].x, game.player[0].y, false);
+		updatePlayerState(&game, 1, game.player[1].x, game.player[1].y, false);
+	}
+	record_end(w, winner);
+	return ply;
+}
+
+int main(void){
+	uint32_t t0, i, reps;
+	uint8_t x, y, o;
+	bool visited[BOARD_SQUARES];
+	uint32_t nodes, think;
+	RecordWriter writer;
+	RecordReader reader;
+	Move m;
+	int plies, errors;
+
+	uart_init();
+	timer_start();
+	profile_init();
+	setupPosition();
+
+	printf("\nQuoridor logic benchmarks (icount shift=%d, CPI=%d.%02d, %d MHz)\n",
+	       BENCH_ICOUNT_SHIFT, BENCH_CPI_X100 / 100, BENCH_CPI_X100 % 100, BENCH_CCLK_MHZ);
+	printf("%-28s %8s %12s %12s %10s\n", "benchmark", "calls", "insn/call", "cycles/call", "us/call");
+
+	/* checkTrap over every wall slot */
+	reps = 0;
+	t0 = timer_read();
+	for (i = 0; i < 20; i++)
+		for (o = 0; o < 2; o++)
+			for (x = 1; x < 7; x++)
+				for (y = 1; y < 7; y++) { sink += checkTrap(&game, x, y, o); reps++; }
+	report("checkTrap", timer_read() - t0, reps);
+
+	/* search from the opponent's square */
+	reps = 1000;
+	t0 = timer_read();
+	for (i = 0; i < reps; i++) {
+		memset(visited, 0, sizeof(visited));
+		sink += search(&game, SQUARE(game.player[1].x, game.player[1].y), visited);
+	}
+	report("search", timer_read() - t0, reps);
+
+	/* updatePlayerState without wall placement */
+	reps = 10000;
+	t0 = timer_read();
+	for (i = 0; i < reps; i++) updatePlayerState(&game, i & 1, game.player[i & 1].x, game.player[i & 1].y, false);
+	report("updatePlayerState", timer_read() - t0, reps);
+
+	/* move generation */
+	reps = 20;
+	t0 = timer_read();
+	for (i = 0; i < reps; i++) sink += genMoves(0);
+	report("genMoves", timer_read() - t0, reps);
+
+	/* fixed-depth tree walk */
+	t0 = timer_read();
+	nodes = perft(BENCH_DEPTH);
+	report("perft (whole tree)", timer_read() - t0, 1);
+	printf("perft depth %d: %lu leaf nodes\n", BENCH_DEPTH, (unsigned long)nodes);
+
+	/* game record: encode a game, then decode it back and compare */
+	plies = recordGame(&writer);
+	reps = 200;
+	t0 = timer_read();
+	for (i = 0; i < reps; i++) {
+		record_begin(&writer, recordBuf, sizeof(recordBuf), RECORD_TIMES, &start);
+		for (x = 0; x < plies; x++) sink += record_move(&writer, played[x], x * 250);
+	}
+	report("record_move", timer_read() - t0, reps * plies);
+	record_end(&writer, winner);
+	errors = 0;
+	t0 = timer_read();
+	for (i = 0; i < reps; i++) {
+		record_open(&reader, recordBuf, writer.len);
+		for (x = 0; record_next(&reader, &m, &think) == RECORD_READ_MOVE; x++) {
+			if (i == 0 && (m.word32 != played[x].word32 || think != x * 250u / RECORD_THINK_MS * RECORD_THINK_MS)) errors++;
+		}
+		sink += x;
+	}
+	report("record_next", timer_read() - t0, reps * plies);
+	printf("record: %d moves in %u bytes, winner %u, %d decode errors\n", plies, writer.len, reader.winner, errors);
+
+	/* profiling zones over the whole run, estimated cycles */
+	printf("\n");
+	profile_report();
+
+	return 0;
+}
+
+/******************************************************************************
+**                            End Of File
+******************************************************************************/
@@ -0,0 +1,20 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           LPC17xx.h
+** Last modified Date:  2026-10-19
+** Last Version:        V1.00
+** Descriptions:        Stand-in for the device header when the game logic is built for the
+**                      QEMU benchmark image: the LPC17xx peripherals are not present there and
+**                      every driver entry point used by quoridor.c is provided by stubs.c.
+** Correlated files:    stubs.c
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#ifndef __LPC17xx_H__
+#define __LPC17xx_H__
+
+#include <stdint.h>
+
+#endif /* end __LPC17xx_H__ */
+/*****************************************************************************
+**                            End Of File
+******************************************************************************/
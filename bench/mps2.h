@@ -0,0 +1,36 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           mps2.h
+** Last modified Date:  2026-10-19
+** Last Version:        V1.00
+** Descriptions:        Registers and helpers of the QEMU mps2-an385 machine used by the benchmarks
+** Correlated files:    startup_mps2.c, bench.c
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#ifndef __MPS2_H
+#define __MPS2_H
+
+#include <stdint.h>
+
+/* Private define ------------------------------------------------------------*/
+#define MPS2_TIMER_HZ    25000000UL       /* APB clock of the CMSDK timers */
+
+#define TIMER0_CTRL      (*(volatile uint32_t *)0x40000000)
+#define TIMER0_VALUE     (*(volatile uint32_t *)0x40000004)
+#define TIMER0_RELOAD    (*(volatile uint32_t *)0x40000008)
+
+#define UART0_DATA       (*(volatile uint32_t *)0x40004000)
+#define UART0_STATE      (*(volatile uint32_t *)0x40004004)
+#define UART0_CTRL       (*(volatile uint32_t *)0x40004008)
+#define UART0_BAUDDIV    (*(volatile uint32_t *)0x40004010)
+
+/* Private function prototypes -----------------------------------------------*/
+void uart_init(void);
+void timer_start(void);
+uint32_t timer_read(void);
+void semihost_exit(int code);
+
+#endif /* end __MPS2_H */
+/*****************************************************************************
+**                            End Of File
+******************************************************************************/
@@ -0,0 +1,109 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           startup_mps2.c
+** Last modified Date:  2026-10-19
+** Last Version:        V1.00
+** Descriptions:        Minimal Cortex-M3 startup, CMSDK UART0/TIMER0 access and semihosting exit
+**                      for the QEMU mps2-an385 machine.
+** Correlated files:    mps2_an385.ld, bench.c
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#include <stdint.h>
+#include <string.h>
+#include "mps2.h"
+
+extern uint32_t __etext, __data_start__, __data_end__, __bss_start__, __bss_end__, __StackTop;
+extern int main(void);
+
+void Reset_Handler(void);
+void Default_Handler(void);
+
+__attribute__((section(".isr_vector"), used))
+static void (* const vectors[16])(void) = {
+	(void (*)(void))&__StackTop,
+	Reset_Handler,
+	Default_Handler,            /* NMI        */
+	Default_Handler,            /* HardFault  */
+	Default_Handler,            /* MemManage  */
+	Default_Handler,            /* BusFault   */
+	Default_Handler,            /* UsageFault */
+	0, 0, 0, 0,
+	Default_Handler,            /* SVCall     */
+	Default_Handler,            /* DebugMon   */
+	0,
+	Default_Handler,            /* PendSV     */
+	Default_Handler,            /* SysTick    */
+};
+
+/******************************************************************************
+** Function name:		Reset_Handler
+**
+** Descriptions:		Copies .data, clears .bss, runs the benchmarks and exits QEMU.
+**
+** parameters:			None
+** Returned value:		None
+**
+******************************************************************************/
+void Reset_Handler(void) {
+	memcpy(&__data_start__, &__etext, (uint32_t)&__data_end__ - (uint32_t)&__data_start__);
+	memset(&__bss_start__, 0, (uint32_t)&__bss_end__ - (uint32_t)&__bss_start__);
+	semihost_exit(main());
+}
+
+void Default_Handler(void) {
+	semihost_exit(2);
+}
+
+/******************************************************************************
+** Function name:		uart_init / _write
+**
+** Descriptions:		CMSDK UART0 transmitter, used by newlib's printf.
+**
+******************************************************************************/
+void uart_init(void) {
+	UART0_BAUDDIV = 16;
+	UART0_CTRL = 1;                            /* TX enable */
+}
+
+int _write(int fd, const char *buf, int len) {
+	int i;
+	for (i = 0; i < len; i++) {
+		while (UART0_STATE & 1);                 /* TX buffer full */
+		UART0_DATA = (uint8_t)buf[i];
+	}
+	return len;
+}
+
+/******************************************************************************
+** Function name:		timer_start / timer_read
+**
+** Descriptions:		CMSDK TIMER0 as a free-running 32-bit down-counter at 25 MHz.
+**
+******************************************************************************/
+void timer_start(void) {
+	TIMER0_CTRL = 0;
+	TIMER0_RELOAD = 0xFFFFFFFF;
+	TIMER0_VALUE = 0xFFFFFFFF;
+	TIMER0_CTRL = 1;
+}
+
+uint32_t timer_read(void) {
+	return 0xFFFFFFFF - TIMER0_VALUE;
+}
+
+/******************************************************************************
+** Function name:		semihost_exit
+**
+** Descriptions:		SYS_EXIT through semihosting (QEMU must run with -semihosting).
+**
+******************************************************************************/
+void semihost_exit(int code) {
+	register uint32_t r0 __asm__("r0") = 0x18;                 /* SYS_EXIT                      */
+	register uint32_t r1 __asm__("r1") = code ? 0x20024 : 0x20026; /* RunTimeError / ApplicationExit */
+	__asm__ volatile ("bkpt 0xab" : : "r"(r0), "r"(r1) : "memory");
+	for (;;);
+}
+
+/******************************************************************************
+**                            End Of File
+******************************************************************************/
@@ -0,0 +1,56 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           stubs.c
+** Last modified Date:  2026-10-19
+** Last Version:        V1.00
+** Descriptions:        No-op GLCD and timer entry points, so that quoridor.c can be linked into the
+**                      benchmark image without the LandTiger peripherals.
+** Correlated files:    bench.c, ../src/quoridor.c
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#include "GLCD/GLCD.h"
+#include "GLCD/LCDCost.h"
+#include "timer/timer.h"
+
+/* GLCD */
+void LCD_Initialization(void) {}
+void LCD_Clear(uint16_t Color) {}
+uint16_t LCD_GetPoint(uint16_t Xpos, uint16_t Ypos) { return 0; }
+void LCD_SetPoint(uint16_t Xpos, uint16_t Ypos, uint16_t point) {}
+void LCD_FillRect(uint16_t Xpos, uint16_t Ypos, uint16_t width, uint16_t height, uint16_t color) {}
+void LCD_DrawBar(uint16_t Xpos, uint16_t Ypos, uint16_t length, uint16_t thickness, uint8_t vertical, uint16_t color) {}
+void LCD_DrawRLE(uint16_t Xpos, uint16_t Ypos, uint16_t width, uint16_t height, const uint16_t *palette, const uint16_t *runs, uint32_t count) {}
+void LCD_DrawLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color) {}
+void PutChar(uint16_t Xpos, uint16_t Ypos, uint8_t ASCI, uint16_t charColor, uint16_t bkColor) {}
+void GUI_Text(uint16_t Xpos, uint16_t Ypos, uint8_t *str, uint16_t Color, uint16_t bkColor) {}
+void GUI_TextSlot(uint8_t slot, uint16_t Xpos, uint16_t Ypos, uint8_t *str, uint16_t Color, uint16_t bkColor) {}
+void GUI_TextSlotSeed(uint8_t slot, uint16_t Xpos, uint16_t Ypos, uint8_t *str, uint16_t Color, uint16_t bkColor) {}
+
+/* LCDList */
+void LCD_ListBegin(void) {}
+void LCD_ListEnd(void) {}
+
+/* LCDCost */
+void LCD_CostBegin(const char *name) {}
+void LCD_CostEnd(void) {}
+void LCD_CostReport(void) {}
+
+/* timer */
+uint32_t init_timer(uint8_t timer_num, uint32_t timerInterval) { return 1; }
+void enable_timer(uint8_t timer_num) {}
+void disable_timer(uint8_t timer_num) {}
+void reset_timer(uint8_t timer_num) {}
+uint32_t read_timebase(void) { return 0; }
+
+/* RIT */
+void poll_joystick(uint8_t on) {}
+void RIT_report(void) {}
+
+/* latency */
+void latency_begin(uint8_t input, uint32_t time) {}
+void latency_end(void) {}
+void latency_cancel(void) {}
+
+/******************************************************************************
+**                            End Of File
+******************************************************************************/
@@ -22,10 +22,32 @@
 /* Includes ------------------------------------------------------------------*/
 #include "GLCD.h" 
 #include "AsciiLib.h"
+#include "LCDCost.h"
+#include "LCDShadow.h"
+#include "LCDList.h"
+#include "../timer/timer.h"
+#include "../profile/profile.h"
+#include <string.h>
+
+extern uint32_t SystemFrequency;
 
 /* Private variables ---------------------------------------------------------*/
 static uint8_t LCD_Code;
 
+/* GRAM address the controller writes next, see LCD_SetPoint. Any index write
+   (register access, window, burst, read) makes it unknown */
+static struct{
+	uint8_t valid;                    /* index is R22h and the address counter is at x, y */
+	uint16_t x, y;
+}gramNext;
+
+/* Last string drawn in each text slot, see GUI_TextSlot */
+static struct{
+	uint16_t x, y, color, bkColor;
+	uint8_t len;                      /* 0: nothing known on screen */
+	char text[LCD_TEXT_LEN];
+}textSlot[LCD_TEXT_SLOTS];
+
 /* Private define ------------------------------------------------------------*/
 #define  ILI9320    0  /* 0x9320 */
 #define  ILI9325    1  /* 0x9325 */
@@ -43,6 +65,189 @@ static uint8_t LCD_Code;
 #define  LGDP4535   13 /* 0x4535 */  
 #define  SSD2119    14 /* 3.5 LCD 0x9919 */
 
+/* ILI932x entry mode (R03h): BGR, I/D = 11 (left to right, top to bottom) */
+#define  ILI932X_ENTRY_MODE   ( (1<<12) | (1<<5) | (1<<4) )
+#define  ILI932X_ENTRY_AM     ( 1<<3 )   /* AM = 1: the address counter runs down the column first */
+
+/* Waits of the ILI932x power-on flow, in microseconds (TIMER1 timebase), from the
+   initial code of the ILITEK ILI9325 application note: 50 ms after reset, 200 ms to
+   discharge the capacitors once R10h-R13h are cleared, 50 ms after each step-up stage
+   (R11h, R12h, R2Bh). The note gives no wait after R20h/R21h, after the gamma block or
+   after display on: those are the 50 ms waits of the original init code, kept */
+#define  ILI932X_T_RESET      50000      /* power-on reset, before R00h is read              */
+#define  ILI932X_T_DISCHARGE  200000     /* power supply discharge, after R13h = 0           */
+#define  ILI932X_T_STEPUP     50000      /* step-up circuits settling, after R11h, R12h, R2Bh */
+#define  ILI932X_T_LEGACY     50000      /* waits of the original init code, not in the note */
+
+/* Propagation through the board's 74HC573 latch / 74HC245 transceiver at 3.3 V, in ns,
+   added to the controller setup and read access times */
+#define  LCD_T_BUFFER         30
+
+/* ns to core cycles at mhz, core cycles to wait_delay iterations (both rounded up) */
+#define  LCD_NS_CYCLES(ns, mhz)   ( ((uint32_t)(ns) * (mhz) + 999) / 1000 )
+#define  LCD_CYCLES_SPINS(c)      ( ((c) + LCD_COST_DELAY_CYCLES - 1) / LCD_COST_DELAY_CYCLES )
+
+/* A bus phase lasts at least its GPIO stores, at the store cost measured on the core
+   (LCD_StoreCycles); the rest of the phase is padded with LCD_BURST_WAIT */
+#define  LCD_STORE_SAMPLES        8
+#define  LCD_PAD_SPINS(c, stores, store)  ( (c) > (stores) * (store) ? \
+                                            LCD_CYCLES_SPINS((c) - (stores) * (store)) : 0 )
+
+/* Bus timing check, compiled in the "Timing Verify" target only (SIMULATOR and
+   LCD_TIMING_VERIFY defined): every phase (setup, WR low, WR high, RD access) of the
+   index, data, read and burst transactions is timed with the profiling counter
+   (PROFILE_NOW) against the profile. The marks lengthen the bus cycles, so the other
+   targets are built without them */
+#if defined(LCD_TIMING_VERIFY) && !defined(SIMULATOR)
+#error "LCD_TIMING_VERIFY is a simulator build: define SIMULATOR as well"
+#endif
+
+/* Private typedef -----------------------------------------------------------*/
+
+/* One step of a controller init sequence: register write, then wait */
+typedef struct{
+	uint16_t reg;
+	uint16_t value;
+	uint32_t delay;                       /* microseconds after the write, 0: none */
+}LCD_InitStep;
+
+/* ILI9325 / ILI9328 */
+static const LCD_InitStep ILI932x_Init[] = {
+	{ 0x00e7, 0x0010, 0 },
+	{ 0x0000, 0x0001, 0 },                /* start internal osc */
+	{ 0x0001, 0x0100, 0 },
+	{ 0x0002, 0x0700, 0 },                /* power on sequence */
+	{ 0x0003, ILI932X_ENTRY_MODE, 0 },    /* importance */
+	{ 0x0004, 0x0000, 0 },
+	{ 0x0008, 0x0207, 0 },
+	{ 0x0009, 0x0000, 0 },
+	{ 0x000a, 0x0000, 0 },                /* display setting */
+	{ 0x000c, 0x0001, 0 },                /* display setting */
+	{ 0x000d, 0x0000, 0 },
+	{ 0x000f, 0x0000, 0 },
+	/* Power On sequence */
+	{ 0x0010, 0x0000, 0 },
+	{ 0x0011, 0x0007, 0 },
+	{ 0x0012, 0x0000, 0 },
+	{ 0x0013, 0x0000, ILI932X_T_DISCHARGE },  /* discharge */
+	{ 0x0010, 0x1590, 0 },
+	{ 0x0011, 0x0227, ILI932X_T_STEPUP },
+	{ 0x0012, 0x009c, ILI932X_T_STEPUP },
+	{ 0x0013, 0x1900, 0 },
+	{ 0x0029, 0x0023, 0 },
+	{ 0x002b, 0x000e, ILI932X_T_STEPUP },
+	{ 0x0020, 0x0000, 0 },
+	{ 0x0021, 0x0000, ILI932X_T_LEGACY },
+	/* gamma */
+	{ 0x0030, 0x0007, 0 },
+	{ 0x0031, 0x0707, 0 },
+	{ 0x0032, 0x0006, 0 },
+	{ 0x0035, 0x0704, 0 },
+	{ 0x0036, 0x1f04, 0 },
+	{ 0x0037, 0x0004, 0 },
+	{ 0x0038, 0x0000, 0 },
+	{ 0x0039, 0x0706, 0 },
+	{ 0x003c, 0x0701, 0 },
+	{ 0x003d, 0x000f, ILI932X_T_LEGACY },
+	/* window and panel */
+	{ 0x0050, 0x0000, 0 },
+	{ 0x0051, 0x00ef, 0 },
+	{ 0x0052, 0x0000, 0 },
+	{ 0x0053, 0x013f, 0 },
+	{ 0x0060, 0xa700, 0 },
+	{ 0x0061, 0x0001, 0 },
+	{ 0x006a, 0x0000, 0 },
+	{ 0x0080, 0x0000, 0 },
+	{ 0x0081, 0x0000, 0 },
+	{ 0x0082, 0x0000, 0 },
+	{ 0x0083, 0x0000, 0 },
+	{ 0x0084, 0x0000, 0 },
+	{ 0x0085, 0x0000, 0 },
+	{ 0x0090, 0x0010, 0 },
+	{ 0x0092, 0x0000, 0 },
+	{ 0x0093, 0x0003, 0 },
+	{ 0x0095, 0x0110, 0 },
+	{ 0x0097, 0x0000, 0 },
+	{ 0x0098, 0x0000, 0 },
+	/* display on sequence */
+	{ 0x0007, 0x0133, 0 },
+	{ 0x0020, 0x0000, 0 },                /* ַ0 */
+	{ 0x0021, 0x0000, ILI932X_T_LEGACY }  /* ַ0 */
+};
+
+/* Supported controllers, by device code (R00h) */
+static const struct{
+	uint16_t id;
+	uint8_t code;                         /* LCD_Code */
+	const LCD_InitStep *steps;
+	uint16_t count;
+}LCD_Controllers[] = {
+	{ 0x9325, ILI9325, ILI932x_Init, sizeof(ILI932x_Init) / sizeof(ILI932x_Init[0]) },
+	{ 0x9328, ILI9325, ILI932x_Init, sizeof(ILI932x_Init) / sizeof(ILI932x_Init[0]) }
+};
+
+/* Bus timing of a controller, 80-system 16-bit interface, in ns (datasheet minimums) */
+typedef struct{
+	uint16_t tAS;                         /* RS/CS setup before WR falls          */
+	uint16_t tWRL;                        /* WR low pulse width (PWLW)            */
+	uint16_t tWRH;                        /* WR high pulse width (PWHW)           */
+	uint16_t tRDD;                        /* RD low to read data valid (tDDR)     */
+}LCD_Timing;
+
+/* ILI9320/9325/9328/9331 AC characteristics */
+static const LCD_Timing ILI932x_Timing = { 10, 50, 50, 100 };
+
+/* Until the device code is read, and for controllers without an init sequence here:
+   the waits the driver always used (22, 1 and 30 wait_delay loops at 100 MHz) */
+static const LCD_Timing LCD_TimingLegacy = { 850, 40, 40, 1170 };
+
+/* Timing profile of each controller, by LCD_Code. Only the ILI932x, the controller
+   the driver initializes, has a datasheet profile: the other codes keep the legacy
+   waits until their AC characteristics and init sequence are added */
+static const LCD_Timing *const LCD_Timings[] = {
+	&ILI932x_Timing,   &ILI932x_Timing,   &ILI932x_Timing,   &ILI932x_Timing,     /* ILI9320 ... ILI9331   */
+	&LCD_TimingLegacy, &LCD_TimingLegacy, &LCD_TimingLegacy, &LCD_TimingLegacy,   /* SSD1298 ... LGDP4531  */
+	&LCD_TimingLegacy, &LCD_TimingLegacy, &LCD_TimingLegacy, &LCD_TimingLegacy,   /* SPFD5408B ... HX8347D */
+	&LCD_TimingLegacy, &LCD_TimingLegacy, &LCD_TimingLegacy                       /* HX8347A ... SSD2119   */
+};
+
+/* Active profile and its conversion to the core clock, see LCD_BusTiming */
+static const LCD_Timing *lcdTiming;
+static struct{
+	uint16_t setup, wrLow, rdAccess;      /* wait_delay iterations                */
+	uint16_t cSetup, cWrLow, cWrHigh, cRdAccess;   /* minimum core cycles         */
+	uint8_t store;                        /* core cycles of one GPIO store        */
+	uint8_t rsSetup;                      /* LCD_BURST_WAIT iterations: setup,    */
+	uint8_t burstLow, pixelHigh;          /* WR low and high of a new pixel,      */
+	uint8_t repeatLow, repeatHigh;        /* WR low and high of a repeated pixel  */
+}lcdBus;
+
+/* Pads a bus phase: spins iterations of a NOP loop, none costs one test */
+#define LCD_BURST_WAIT(spins)                              \
+	{ uint32_t n = (spins); while( n != 0 ) { n--; __NOP(); } }
+
+#ifdef LCD_TIMING_VERIFY
+uint32_t LCD_TimingViolations = 0;
+static uint32_t lcdPhaseMark;             /* PROFILE_NOW at the start of the phase   */
+static uint32_t lcdPhaseHigh;             /* minimum cycles before the next WR falls */
+static uint32_t lcdPhaseProbe;            /* cycles of a mark and a check alone      */
+#define LCD_PHASE_BEGIN()         lcdPhaseMark = PROFILE_NOW();
+#define LCD_PHASE_END(min)        { if( ((PROFILE_NOW() - lcdPhaseMark) & PROFILE_MASK) < \
+                                      (uint32_t)(min) + lcdPhaseProbe ) LCD_TimingViolations++; }
+/* RS, CS or the data just became valid: the next WR fall waits the setup */
+#define LCD_VERIFY_SETUP()        lcdPhaseHigh = lcdBus.cSetup; LCD_PHASE_BEGIN()
+#define LCD_VERIFY_WR_FELL()      LCD_PHASE_END(lcdPhaseHigh) lcdPhaseHigh = lcdBus.cWrHigh; LCD_PHASE_BEGIN()
+#define LCD_VERIFY_WR_ROSE()      LCD_PHASE_END(lcdBus.cWrLow) LCD_PHASE_BEGIN()
+#define LCD_VERIFY_RD_BEGIN()     LCD_PHASE_BEGIN()
+#define LCD_VERIFY_RD_SAMPLE()    LCD_PHASE_END(lcdBus.cRdAccess)
+#else
+#define LCD_VERIFY_SETUP()
+#define LCD_VERIFY_WR_FELL()
+#define LCD_VERIFY_WR_ROSE()
+#define LCD_VERIFY_RD_BEGIN()
+#define LCD_VERIFY_RD_SAMPLE()
+#endif
+
 /*******************************************************************************
 * Function Name  : Lcd_Configuration
 * Description    : Configures LCD Control lines
@@ -78,6 +283,7 @@ static __attribute__((always_inline)) void LCD_Send (uint16_t byte)
 	LCD_LE(1)                         
 	LCD_LE(0)														/* latch D0..D7	*/
 	LPC_GPIO2->FIOPIN =  byte >> 8;     /* Write D8..D15 */
+	LCD_COST_GPIO(7);
 }
 
 /*******************************************************************************
@@ -91,6 +297,7 @@ static __attribute__((always_inline)) void LCD_Send (uint16_t byte)
 *******************************************************************************/
 static void wait_delay(int count)
 {
+	LCD_COST_DELAY(count);
 	while(count--);
 }
 
@@ -109,12 +316,16 @@ static __attribute__((always_inline)) uint16_t LCD_Read (void)
 	LPC_GPIO2->FIODIR &= ~(0xFF);              /* P2.0...P2.7 Input */
 	LCD_DIR(0);		   				           				 /* Interface B->A */
 	LCD_EN(0);	                               /* Enable 2B->2A */
-	wait_delay(30);							   						 /* delay some times */
+	wait_delay(lcdBus.rdAccess);                /* RD low to data valid */
 	value = LPC_GPIO2->FIOPIN0;                /* Read D8..D15 */
+	LCD_VERIFY_RD_SAMPLE();
 	LCD_EN(1);	                               /* Enable 1B->1A */
-	wait_delay(30);							   						 /* delay some times */
+	LCD_VERIFY_RD_BEGIN();
+	wait_delay(lcdBus.rdAccess);                /* transceiver switch */
 	value = (value << 8) | LPC_GPIO2->FIOPIN0; /* Read D0..D7 */
+	LCD_VERIFY_RD_SAMPLE();
 	LCD_DIR(1);
+	LCD_COST_GPIO(5);
 	return  value;
 }
 
@@ -128,15 +339,21 @@ static __attribute__((always_inline)) uint16_t LCD_Read (void)
 *******************************************************************************/
 static __attribute__((always_inline)) void LCD_WriteIndex(uint16_t index)
 {
+	gramNext.valid = 0;
 	LCD_CS(0);
 	LCD_RS(0);
 	LCD_RD(1);
 	LCD_Send( index ); 
-	wait_delay(22);	
+	LCD_VERIFY_SETUP();
+	wait_delay(lcdBus.setup);
 	LCD_WR(0);  
-	wait_delay(1);
+	LCD_VERIFY_WR_FELL();
+	wait_delay(lcdBus.wrLow);
 	LCD_WR(1);
+	LCD_VERIFY_WR_ROSE();
 	LCD_CS(1);
+	LCD_COST_GPIO(6);
+	LCD_COST_INDEX();
 }
 
 /*******************************************************************************
@@ -151,11 +368,150 @@ static __attribute__((always_inline)) void LCD_WriteData(uint16_t data)
 {				
 	LCD_CS(0);
 	LCD_RS(1);   
+	LCD_VERIFY_SETUP();
 	LCD_Send( data );
+	LCD_BURST_WAIT(lcdBus.rsSetup);
 	LCD_WR(0);     
-	wait_delay(1);
+	LCD_VERIFY_WR_FELL();
+	wait_delay(lcdBus.wrLow);
 	LCD_WR(1);
+	LCD_VERIFY_WR_ROSE();
 	LCD_CS(1);
+	LCD_COST_GPIO(5);
+	LCD_COST_DELAY(lcdBus.rsSetup);
+	LCD_COST_DATA();
+}
+
+/*******************************************************************************
+* Function Name  : LCD_BurstBegin / LCD_BurstEnd
+* Description    : Open and close a data burst: CS, RS, bus direction and the
+*                  2A->2B transceiver are set once for the whole transfer, then
+*                  the setup the following stores do not cover is padded.
+* Input          : None
+* Output         : None
+* Return         : None
+* Attention		 : Only LE, WR and the P2 data lines may change inside a burst
+*******************************************************************************/
+static __attribute__((always_inline)) void LCD_BurstBegin(void)
+{
+	LCD_CS(0);
+	LCD_RS(1);
+	LCD_VERIFY_SETUP();
+	LPC_GPIO2->FIODIR |= 0xFF;          /* P2.0...P2.7 Output */
+	LCD_DIR(1)		   				    				/* Interface A->B */
+	LCD_EN(0)	                        	/* Enable 2A->2B */
+	LCD_BURST_WAIT(lcdBus.rsSetup);
+	LCD_COST_GPIO(5);
+	LCD_COST_DELAY(lcdBus.rsSetup);
+}
+
+static __attribute__((always_inline)) void LCD_BurstEnd(void)
+{
+	LCD_CS(1);
+	LCD_COST_GPIO(1);
+}
+
+/* One pixel inside a burst: D0..D7 are latched while WR is high, WR falls, D8..D15
+   are driven, WR rises. WR stays high for four stores and low for two, each phase
+   padded to the profile (high, low: lcdBus.pixelHigh, lcdBus.burstLow) */
+#define LCD_BURST_PIXEL(data, high, low)                   \
+	LPC_GPIO2->FIOPIN = (data);          /* D0..D7  */     \
+	LCD_LE(1)                                              \
+	LCD_LE(0)                            /* latch   */     \
+	LCD_BURST_WAIT(high)                                   \
+	LCD_WR(0)                                              \
+	LCD_VERIFY_WR_FELL()                                   \
+	LPC_GPIO2->FIOPIN = (data) >> 8;     /* D8..D15 */     \
+	LCD_BURST_WAIT(low)                                    \
+	LCD_WR(1)                                              \
+	LCD_VERIFY_WR_ROSE()
+
+/* Same pixel again: latch and bus already hold it, only WR is strobed. Each WR phase
+   is a single store, padded to the profile (high, low: lcdBus.repeatHigh,
+   lcdBus.repeatLow) */
+#define LCD_BURST_REPEAT(high, low)                        \
+	LCD_BURST_WAIT(high)                                   \
+	LCD_WR(0)                                              \
+	LCD_VERIFY_WR_FELL()                                   \
+	LCD_BURST_WAIT(low)                                    \
+	LCD_WR(1)                                              \
+	LCD_VERIFY_WR_ROSE()
+
+/*******************************************************************************
+* Function Name  : LCD_WriteDataBurst
+* Description    : Streams count pixels to the current index (normally GRAM).
+* Input          : - data: pixels
+*                  - count: number of pixels
+* Output         : None
+* Return         : None
+* Attention		 : None
+*******************************************************************************/
+static void LCD_WriteDataBurst(const uint16_t *data, uint32_t count)
+{
+	uint32_t high = lcdBus.pixelHigh, low = lcdBus.burstLow;
+
+	LCD_COST_GPIO(6 * count);
+	LCD_COST_BURST(count);
+	LCD_COST_DELAY(count * (high + low));
+	LCD_BurstBegin();
+	while( count >= 4 )
+	{
+		LCD_BURST_PIXEL(data[0], high, low);
+		LCD_BURST_PIXEL(data[1], high, low);
+		LCD_BURST_PIXEL(data[2], high, low);
+		LCD_BURST_PIXEL(data[3], high, low);
+		data += 4;
+		count -= 4;
+	}
+	while( count-- )
+	{
+		LCD_BURST_PIXEL(data[0], high, low);    /* the macro reads its argument twice */
+		data++;
+	}
+	LCD_BurstEnd();
+}
+
+/*******************************************************************************
+* Function Name  : LCD_WriteDataRepeat
+* Description    : Streams count copies of one pixel to the current index. The
+*                  first pixel sets latch and bus, the others only strobe WR.
+* Input          : - color: pixel value
+*                  - count: number of pixels
+* Output         : None
+* Return         : None
+* Attention		 : None
+*******************************************************************************/
+static void LCD_WriteDataRepeat(uint16_t color, uint32_t count)
+{
+	uint32_t high = lcdBus.repeatHigh, low = lcdBus.repeatLow;
+
+	if( count == 0 )
+	{
+		return;
+	}
+	LCD_COST_GPIO(6 + 2 * (count - 1));
+	LCD_COST_BURST(count);
+	LCD_COST_DELAY(lcdBus.pixelHigh + lcdBus.burstLow + (count - 1) * (high + low));
+	LCD_BurstBegin();
+	LCD_BURST_PIXEL(color, lcdBus.pixelHigh, lcdBus.burstLow);
+	count--;
+	while( count >= 8 )
+	{
+		LCD_BURST_REPEAT(high, low);
+		LCD_BURST_REPEAT(high, low);
+		LCD_BURST_REPEAT(high, low);
+		LCD_BURST_REPEAT(high, low);
+		LCD_BURST_REPEAT(high, low);
+		LCD_BURST_REPEAT(high, low);
+		LCD_BURST_REPEAT(high, low);
+		LCD_BURST_REPEAT(high, low);
+		count -= 8;
+	}
+	while( count-- )
+	{
+		LCD_BURST_REPEAT(high, low);
+	}
+	LCD_BurstEnd();
 }
 
 /*******************************************************************************
@@ -174,10 +530,13 @@ static __attribute__((always_inline)) uint16_t LCD_ReadData(void)
 	LCD_RS(1);
 	LCD_WR(1);
 	LCD_RD(0);
+	LCD_VERIFY_RD_BEGIN();
 	value = LCD_Read();
 	
 	LCD_RD(1);
 	LCD_CS(1);
+	LCD_COST_GPIO(6);
+	LCD_COST_DATA();
 	
 	return value;
 }
@@ -269,112 +628,201 @@ static void LCD_SetCursor(uint16_t Xpos,uint16_t Ypos)
 }
 
 /*******************************************************************************
-* Function Name  : LCD_Delay
-* Description    : Delay Time
-* Input          : - nCount: Delay Time
+* Function Name  : LCD_SetWindow
+* Description    : Sets the GRAM window (inclusive bounds) and moves the cursor to
+*                  its top-left corner. GRAM writes then auto-increment inside it.
+* Input          : - x0, y0: top-left corner
+*                  - x1, y1: bottom-right corner
+* Output         : None
+* Return         : None
+* Attention		 : Only for DISP_ORIENTATION 0/180
+*******************************************************************************/
+static void LCD_SetWindow(uint16_t x0,uint16_t y0,uint16_t x1,uint16_t y1)
+{
+  switch( LCD_Code )
+  {
+     default:		 /* 0x9320 0x9325 0x9328 0x9331 0x5408 0x1505 0x0505 0x7783 0x4531 0x4535 */
+          LCD_WriteReg(0x0050, x0 );     /* horizontal start */
+          LCD_WriteReg(0x0051, x1 );     /* horizontal end   */
+          LCD_WriteReg(0x0052, y0 );     /* vertical start   */
+          LCD_WriteReg(0x0053, y1 );     /* vertical end     */
+          LCD_SetCursor(x0, y0);
+	      break; 
+
+     case SSD1298: 	 /* 0x8999 */
+     case SSD1289:   /* 0x8989 */
+          LCD_WriteReg(0x0044, (x1 << 8) | x0 );   /* HEA | HSA        */
+          LCD_WriteReg(0x0045, y0 );               /* vertical start   */
+          LCD_WriteReg(0x0046, y1 );               /* vertical end     */
+          LCD_SetCursor(x0, y0);
+	      break;  
+
+     case HX8346A: 	 /* 0x0046 */
+     case HX8347A: 	 /* 0x0047 */
+     case HX8347D: 	 /* 0x0047 */
+	      LCD_WriteReg(0x02, x0>>8 );    /* column start, also the cursor */
+	      LCD_WriteReg(0x03, x0 );  
+	      LCD_WriteReg(0x04, x1>>8 );                           
+	      LCD_WriteReg(0x05, x1 );  
+	      LCD_WriteReg(0x06, y0>>8 );    /* row start, also the cursor    */
+	      LCD_WriteReg(0x07, y0 );    
+	      LCD_WriteReg(0x08, y1>>8 );                           
+	      LCD_WriteReg(0x09, y1 );  
+	      break;     
+     case SSD2119:	 /* 3.5 LCD 0x9919 */
+	      break; 
+  }
+}
+
+/*******************************************************************************
+* Function Name  : LCD_ColumnBegin / LCD_ColumnEnd
+* Description    : Opens a GRAM write that runs down a column from (Xpos,Ypos):
+*                  entry mode AM = 1, so no window has to be programmed for a
+*                  one-pixel wide strip. LCD_ColumnEnd restores the row order.
+* Input          : - Xpos, Ypos: first pixel of the column
 * Output         : None
 * Return         : None
+* Attention		 : ILI932x only (LCD_Code == ILI9325), DISP_ORIENTATION 0/180
+*******************************************************************************/
+static void LCD_ColumnBegin(uint16_t Xpos,uint16_t Ypos)
+{
+	LCD_WriteReg(0x0003, ILI932X_ENTRY_MODE | ILI932X_ENTRY_AM);
+	LCD_SetCursor(Xpos, Ypos);
+	LCD_WriteIndex(0x0022);
+}
+
+static void LCD_ColumnEnd(void)
+{
+	LCD_WriteReg(0x0003, ILI932X_ENTRY_MODE);
+}
+
+/*******************************************************************************
+* Function Name  : LCD_RunInit
+* Description    : Runs a controller init sequence: each step writes a register,
+*                  then waits its delay on the timebase.
+* Input          : - steps: init sequence
+*                  - count: number of steps
+* Output         : None
 * Return         : None
 * Attention		 : None
 *******************************************************************************/
-static void delay_ms(uint16_t ms)    
-{ 
-	uint16_t i,j; 
-	for( i = 0; i < ms; i++ )
-	{ 
-		for( j = 0; j < 1141; j++ );
+static void LCD_RunInit(const LCD_InitStep *steps, uint16_t count)
+{
+	uint16_t i;
+
+	for( i = 0; i < count; i++ )
+	{
+		LCD_WriteReg(steps[i].reg, steps[i].value);
+		if( steps[i].delay != 0 )
+		{
+			LCD_COST_DELAY((uint32_t)steps[i].delay * LCD_COST_CCLK_MHZ / LCD_COST_DELAY_CYCLES);
+			delay_us(steps[i].delay);
+		}
 	}
-} 
+}
 
+/*******************************************************************************
+* Function Name  : LCD_StoreCycles
+* Description    : Measures the core cycles of one GPIO store with the profiling
+*                  counter: LCD_STORE_SAMPLES writes of WR high (its idle level),
+*                  less the cost of reading the counter, rounded down.
+* Input          : None
+* Output         : None
+* Return         : cycles per store, 0 if the counter does not run
+* Attention		 : Rounding down only lengthens the padded phases
+*******************************************************************************/
+static uint32_t LCD_StoreCycles(void)
+{
+	uint32_t t0, t1, t2, empty, stores;
+
+	t0 = PROFILE_NOW();
+	t1 = PROFILE_NOW();
+	LCD_WR(1)
+	LCD_WR(1)
+	LCD_WR(1)
+	LCD_WR(1)
+	LCD_WR(1)
+	LCD_WR(1)
+	LCD_WR(1)
+	LCD_WR(1)
+	t2 = PROFILE_NOW();
+	empty  = (t1 - t0) & PROFILE_MASK;
+	stores = (t2 - t1) & PROFILE_MASK;
+	return stores > empty ? (stores - empty) / LCD_STORE_SAMPLES : 0;
+}
+
+/*******************************************************************************
+* Function Name  : LCD_BusTiming
+* Description    : Converts the timing profile of the controller into minimum core
+*                  cycles and wait_delay iterations at the current SystemFrequency.
+*                  Index writes wait the setup before WR falls, every write holds WR
+*                  low, reads wait the access time on each half of the bus. Data
+*                  writes and bursts pad each phase beyond the time of its own GPIO
+*                  stores, at the store cost measured on the core.
+* Input          : None
+* Output         : None
+* Return         : None
+* Attention		 : Call again after changing the core clock. SysTick is left to
+*                  the profiling counter (profile_init)
+*******************************************************************************/
+void LCD_BusTiming(void)
+{
+	uint32_t mhz = SystemFrequency / 1000000;
+
+	lcdBus.cSetup    = LCD_NS_CYCLES(lcdTiming->tAS + LCD_T_BUFFER, mhz);
+	lcdBus.cWrLow    = LCD_NS_CYCLES(lcdTiming->tWRL, mhz);
+	lcdBus.cWrHigh   = LCD_NS_CYCLES(lcdTiming->tWRH, mhz);
+	lcdBus.cRdAccess = LCD_NS_CYCLES(lcdTiming->tRDD + LCD_T_BUFFER, mhz);
+	lcdBus.setup     = LCD_CYCLES_SPINS(lcdBus.cSetup);
+	lcdBus.wrLow     = LCD_CYCLES_SPINS(lcdBus.cWrLow);
+	lcdBus.rdAccess  = LCD_CYCLES_SPINS(lcdBus.cRdAccess);
+	/* stores already in each phase: RS to WR fall 7 (LCD_Send, or LCD_BurstBegin and the
+	   latch of the first pixel), then as in LCD_BURST_PIXEL and LCD_BURST_REPEAT */
+	lcdBus.store      = LCD_StoreCycles();
+	lcdBus.rsSetup    = LCD_PAD_SPINS(lcdBus.cSetup, 7, lcdBus.store);
+	lcdBus.burstLow   = LCD_PAD_SPINS(lcdBus.cWrLow, 2, lcdBus.store);
+	lcdBus.pixelHigh  = LCD_PAD_SPINS(lcdBus.cWrHigh, 4, lcdBus.store);
+	lcdBus.repeatLow  = LCD_PAD_SPINS(lcdBus.cWrLow, 1, lcdBus.store);
+	lcdBus.repeatHigh = LCD_PAD_SPINS(lcdBus.cWrHigh, 1, lcdBus.store);
+#ifdef LCD_TIMING_VERIFY
+	LCD_PHASE_BEGIN();
+	lcdPhaseProbe = (PROFILE_NOW() - lcdPhaseMark) & PROFILE_MASK;
+#endif
+}
 
 /*******************************************************************************
 * Function Name  : LCD_Initializtion
-* Description    : Initialize TFT Controller.
+* Description    : Initialize TFT Controller: reads the device code and runs the
+*                  init sequence of the matching controller.
 * Input          : None
 * Output         : None
 * Return         : None
-* Attention		 : None
+* Attention		 : Uses the TIMER1 timebase (started if needed)
 *******************************************************************************/
 void LCD_Initialization(void)
 {
 	uint16_t DeviceCode;
+	uint8_t i;
 	
 	LCD_Configuration();
-	delay_ms(100);
+	lcdTiming = &LCD_TimingLegacy;            /* until the device code is known */
+	LCD_BusTiming();
+	LCD_ShadowInvalidate();   /* GRAM content is undefined after reset */
+	LCD_COST_DELAY((uint32_t)ILI932X_T_RESET * LCD_COST_CCLK_MHZ / LCD_COST_DELAY_CYCLES);
+	delay_us(ILI932X_T_RESET);
 	DeviceCode = LCD_ReadReg(0x0000);		/* ȡID	*/	
 	
-	if( DeviceCode == 0x9325 || DeviceCode == 0x9328 )	
-	{
-		LCD_Code = ILI9325;
-		LCD_WriteReg(0x00e7,0x0010);      
-		LCD_WriteReg(0x0000,0x0001);  	/* start internal osc */
-		LCD_WriteReg(0x0001,0x0100);     
-		LCD_WriteReg(0x0002,0x0700); 	/* power on sequence */
-		LCD_WriteReg(0x0003,(1<<12)|(1<<5)|(1<<4)|(0<<3) ); 	/* importance */
-		LCD_WriteReg(0x0004,0x0000);                                   
-		LCD_WriteReg(0x0008,0x0207);	           
-		LCD_WriteReg(0x0009,0x0000);         
-		LCD_WriteReg(0x000a,0x0000); 	/* display setting */        
-		LCD_WriteReg(0x000c,0x0001);	/* display setting */        
-		LCD_WriteReg(0x000d,0x0000); 			        
-		LCD_WriteReg(0x000f,0x0000);
-		/* Power On sequence */
-		LCD_WriteReg(0x0010,0x0000);   
-		LCD_WriteReg(0x0011,0x0007);
-		LCD_WriteReg(0x0012,0x0000);                                                                 
-		LCD_WriteReg(0x0013,0x0000);                 
-		delay_ms(50);  /* delay 50 ms */		
-		LCD_WriteReg(0x0010,0x1590);   
-		LCD_WriteReg(0x0011,0x0227);
-		delay_ms(50);  /* delay 50 ms */		
-		LCD_WriteReg(0x0012,0x009c);                  
-		delay_ms(50);  /* delay 50 ms */		
-		LCD_WriteReg(0x0013,0x1900);   
-		LCD_WriteReg(0x0029,0x0023);
-		LCD_WriteReg(0x002b,0x000e);
-		delay_ms(50);  /* delay 50 ms */		
-		LCD_WriteReg(0x0020,0x0000);                                                            
-		LCD_WriteReg(0x0021,0x0000);           
-		delay_ms(50);  /* delay 50 ms */		
-		LCD_WriteReg(0x0030,0x0007); 
-		LCD_WriteReg(0x0031,0x0707);   
-		LCD_WriteReg(0x0032,0x0006);
-		LCD_WriteReg(0x0035,0x0704);
-		LCD_WriteReg(0x0036,0x1f04); 
-		LCD_WriteReg(0x0037,0x0004);
-		LCD_WriteReg(0x0038,0x0000);        
-		LCD_WriteReg(0x0039,0x0706);     
-		LCD_WriteReg(0x003c,0x0701);
-		LCD_WriteReg(0x003d,0x000f);
-		delay_ms(50);  /* delay 50 ms */		
-		LCD_WriteReg(0x0050,0x0000);        
-		LCD_WriteReg(0x0051,0x00ef);   
-		LCD_WriteReg(0x0052,0x0000);     
-		LCD_WriteReg(0x0053,0x013f);
-		LCD_WriteReg(0x0060,0xa700);        
-		LCD_WriteReg(0x0061,0x0001); 
-		LCD_WriteReg(0x006a,0x0000);
-		LCD_WriteReg(0x0080,0x0000);
-		LCD_WriteReg(0x0081,0x0000);
-		LCD_WriteReg(0x0082,0x0000);
-		LCD_WriteReg(0x0083,0x0000);
-		LCD_WriteReg(0x0084,0x0000);
-		LCD_WriteReg(0x0085,0x0000);
-		  
-		LCD_WriteReg(0x0090,0x0010);     
-		LCD_WriteReg(0x0092,0x0000);  
-		LCD_WriteReg(0x0093,0x0003);
-		LCD_WriteReg(0x0095,0x0110);
-		LCD_WriteReg(0x0097,0x0000);        
-		LCD_WriteReg(0x0098,0x0000);  
-		/* display on sequence */    
-		LCD_WriteReg(0x0007,0x0133);
-		
-		LCD_WriteReg(0x0020,0x0000);  /* ַ0 */                                                          
-		LCD_WriteReg(0x0021,0x0000);  /* ַ0 */     
+	for( i = 0; i < sizeof(LCD_Controllers) / sizeof(LCD_Controllers[0]); i++ )
+	{
+		if( LCD_Controllers[i].id == DeviceCode )
+		{
+			LCD_Code = LCD_Controllers[i].code;
+			lcdTiming = LCD_Timings[LCD_Code];
+			LCD_BusTiming();
+			LCD_RunInit(LCD_Controllers[i].steps, LCD_Controllers[i].count);
+			break;
+		}
 	}
-
-    delay_ms(50);   /* delay 50 ms */	
 }
 
 /*******************************************************************************
@@ -387,8 +835,9 @@ void LCD_Initialization(void)
 *******************************************************************************/
 void LCD_Clear(uint16_t Color)
 {
-	uint32_t index;
-	
+	PROFILE_BEGIN(PROFILE_LCD_CLEAR);
+	LCD_LIST_BARRIER();
+	LCD_COST_BEGIN("LCD_Clear");
 	if( LCD_Code == HX8347D || LCD_Code == HX8347A )
 	{
 		LCD_WriteReg(0x02,0x00);                                                  
@@ -409,10 +858,11 @@ void LCD_Clear(uint16_t Color)
 	}	
 
 	LCD_WriteIndex(0x0022);
-	for( index = 0; index < MAX_X * MAX_Y; index++ )
-	{
-		LCD_WriteData(Color);
-	}
+	LCD_WriteDataRepeat(Color, (uint32_t)MAX_X * MAX_Y);
+	LCD_ShadowFill(0, 0, MAX_X, MAX_Y, Color);
+	memset(textSlot, 0, sizeof(textSlot));
+	LCD_COST_END();
+	PROFILE_END(PROFILE_LCD_CLEAR);
 }
 
 /******************************************************************************
@@ -449,6 +899,7 @@ uint16_t LCD_GetPoint(uint16_t Xpos,uint16_t Ypos)
 {
 	uint16_t dummy;
 	
+	LCD_LIST_BARRIER();
 	LCD_SetCursor(Xpos,Ypos);
 	LCD_WriteIndex(0x0022);  
 	
@@ -485,7 +936,10 @@ uint16_t LCD_GetPoint(uint16_t Xpos,uint16_t Ypos)
 
 /******************************************************************************
 * Function Name  : LCD_SetPoint
-* Description    : ָ껭
+* Description    : ָ껭. Sequential points (left to right, wrapping to
+*                  the next row) follow the GRAM address counter: when the
+*                  previous point left it on this pixel, only the data is sent,
+*                  without cursor and index writes.
 * Input          : - Xpos: Row Coordinate
 *                  - Ypos: Line Coordinate 
 * Output         : None
@@ -498,8 +952,329 @@ void LCD_SetPoint(uint16_t Xpos,uint16_t Ypos,uint16_t point)
 	{
 		return;
 	}
-	LCD_SetCursor(Xpos,Ypos);
-	LCD_WriteReg(0x0022,point);
+	if( LCD_LIST_RECORD(Xpos, Ypos, 1, 1, point) )
+	{
+		return;
+	}
+	if( gramNext.valid && gramNext.x == Xpos && gramNext.y == Ypos )
+	{
+		LCD_WriteData(point);
+	}
+	else
+	{
+		LCD_SetCursor(Xpos,Ypos);
+		LCD_WriteReg(0x0022,point);
+	}
+	LCD_ShadowStore(Xpos,Ypos,point);
+
+#if  ( DISP_ORIENTATION == 0 ) || ( DISP_ORIENTATION == 180 )
+	if( LCD_Code == ILI9325 )
+	{
+		/* I/D = 11, AM = 0 in the full-screen window: next column, then next row */
+		gramNext.x = Xpos + 1;
+		gramNext.y = Ypos;
+		if( gramNext.x == MAX_X )
+		{
+			gramNext.x = 0;
+			gramNext.y = ( Ypos + 1 == MAX_Y ) ? 0 : Ypos + 1;
+		}
+		gramNext.valid = 1;
+	}
+#endif
+}
+
+/******************************************************************************
+* Function Name  : LCD_FillRect
+* Description    : Fills a rectangle with one colour. The controller window is
+*                  programmed once and the pixels are streamed through GRAM
+*                  auto-increment, instead of one cursor update per pixel.
+* Input          : - Xpos: left column
+*                  - Ypos: top row
+*                  - width, height: size in pixels (clipped to the screen)
+*                  - color: fill colour
+* Output         : None
+* Return         : None
+* Attention		 : None
+*******************************************************************************/
+void LCD_FillRect(uint16_t Xpos,uint16_t Ypos,uint16_t width,uint16_t height,uint16_t color)
+{
+#if  ( DISP_ORIENTATION == 90 ) || ( DISP_ORIENTATION == 270 )
+	uint16_t index, count;
+#endif
+
+	if( Xpos >= MAX_X || Ypos >= MAX_Y || width == 0 || height == 0 )
+	{
+		return;
+	}
+	if( width > MAX_X - Xpos )
+	{
+		width = MAX_X - Xpos;
+	}
+	if( height > MAX_Y - Ypos )
+	{
+		height = MAX_Y - Ypos;
+	}
+	if( LCD_LIST_RECORD(Xpos, Ypos, width, height, color) )
+	{
+		return;
+	}
+
+#if  ( DISP_ORIENTATION == 90 ) || ( DISP_ORIENTATION == 270 )
+	for( count = 0; count < height; count++ )
+	{
+		for( index = 0; index < width; index++ )
+		{
+			LCD_SetPoint(Xpos + index, Ypos + count, color);
+		}
+	}
+#else
+	if( LCD_Code == SSD2119 )
+	{
+		return;
+	}
+	LCD_ShadowFill(Xpos, Ypos, width, height, color);
+	if( height == 1 )
+	{
+		/* a single row needs no window: the full-screen one increments along it */
+		LCD_SetCursor(Xpos, Ypos);
+		LCD_WriteIndex(0x0022);
+		LCD_WriteDataRepeat(color, width);
+		return;
+	}
+	LCD_SetWindow(Xpos, Ypos, Xpos + width - 1, Ypos + height - 1);
+	LCD_WriteIndex(0x0022);
+	LCD_WriteDataRepeat(color, (uint32_t)width * height);
+	/* back to the full screen, LCD_SetPoint and LCD_Clear rely on it */
+	LCD_SetWindow(0, 0, MAX_X - 1, MAX_Y - 1);
+#endif
+}
+
+/******************************************************************************
+* Function Name  : LCD_DrawBar
+* Description    : Draws an axis-aligned bar (a thick horizontal or vertical
+*                  line). A horizontal bar is one Nx2 window burst; a vertical
+*                  bar streams down each of its columns with the entry mode set
+*                  to vertical increment, without touching the window. While a
+*                  display list is open the bar is recorded once, as a rectangle.
+* Input          : - Xpos, Ypos: top-left corner
+*                  - length: size along the bar
+*                  - thickness: size across the bar
+*                  - vertical: 0 = horizontal, 1 = vertical
+*                  - color: bar colour
+* Output         : None
+* Return         : None
+* Attention		 : None
+*******************************************************************************/
+void LCD_DrawBar(uint16_t Xpos,uint16_t Ypos,uint16_t length,uint16_t thickness,uint8_t vertical,uint16_t color)
+{
+	uint16_t width, height;
+#if  ( DISP_ORIENTATION == 0 ) || ( DISP_ORIENTATION == 180 )
+	uint16_t i;
+#endif
+
+	if( !vertical )
+	{
+		LCD_FillRect(Xpos, Ypos, length, thickness, color);
+		return;
+	}
+	width = thickness;
+	height = length;
+	if( Xpos >= MAX_X || Ypos >= MAX_Y || width == 0 || height == 0 )
+	{
+		return;
+	}
+	if( width > MAX_X - Xpos )
+	{
+		width = MAX_X - Xpos;
+	}
+	if( height > MAX_Y - Ypos )
+	{
+		height = MAX_Y - Ypos;
+	}
+	if( LCD_LIST_RECORD(Xpos, Ypos, width, height, color) )
+	{
+		return;
+	}
+#if  ( DISP_ORIENTATION == 0 ) || ( DISP_ORIENTATION == 180 )
+	if( LCD_Code == ILI9325 )
+	{
+		for( i = 0; i < width; i++ )
+		{
+			LCD_ColumnBegin(Xpos + i, Ypos);
+			LCD_WriteDataRepeat(color, height);
+		}
+		LCD_ColumnEnd();
+		LCD_ShadowFill(Xpos, Ypos, width, height, color);
+		return;
+	}
+#endif
+	LCD_FillRect(Xpos, Ypos, width, height, color);
+}
+
+/******************************************************************************
+* Function Name  : LCD_DrawImage
+* Description    : Draws a rectangle of individual pixels through one window
+*                  burst (one cursor update for a single row).
+* Input          : - Xpos: left column
+*                  - Ypos: top row
+*                  - width, height: size in pixels
+*                  - pixels: colours, row by row
+* Output         : None
+* Return         : None
+* Attention		 : The image must lie entirely on the screen
+*******************************************************************************/
+void LCD_DrawImage(uint16_t Xpos,uint16_t Ypos,uint16_t width,uint16_t height,const uint16_t *pixels)
+{
+	uint16_t i, j;
+
+	LCD_LIST_BARRIER();
+	if( Xpos >= MAX_X || Ypos >= MAX_Y || width == 0 || height == 0 ||
+	    width > MAX_X - Xpos || height > MAX_Y - Ypos )
+	{
+		return;
+	}
+
+#if  ( DISP_ORIENTATION == 0 ) || ( DISP_ORIENTATION == 180 )
+	if( LCD_Code == ILI9325 && width == 1 && height > 1 )
+	{
+		/* a single column needs no window either */
+		LCD_ColumnBegin(Xpos, Ypos);
+		LCD_WriteDataBurst(pixels, height);
+		LCD_ColumnEnd();
+		LCD_ShadowBlit(Xpos, Ypos, width, height, pixels);
+		return;
+	}
+	if( LCD_Code != SSD2119 )
+	{
+		if( height == 1 )
+		{
+			LCD_SetCursor(Xpos, Ypos);
+			LCD_WriteIndex(0x0022);
+			LCD_WriteDataBurst(pixels, width);
+		}
+		else
+		{
+			LCD_SetWindow(Xpos, Ypos, Xpos + width - 1, Ypos + height - 1);
+			LCD_WriteIndex(0x0022);
+			LCD_WriteDataBurst(pixels, (uint32_t)width * height);
+			LCD_SetWindow(0, 0, MAX_X - 1, MAX_Y - 1);
+		}
+		LCD_ShadowBlit(Xpos, Ypos, width, height, pixels);
+		return;
+	}
+#endif
+	for( i = 0; i < height; i++ )
+	{
+		for( j = 0; j < width; j++ )
+		{
+			LCD_SetPoint(Xpos + j, Ypos + i, pixels[i * width + j]);
+		}
+	}
+}
+
+/******************************************************************************
+* Function Name  : LCD_DrawRLE
+* Description    : Streams a run-length encoded image through one window: every
+*                  run is a single repeated pixel burst, the window wraps the
+*                  runs from one row to the next.
+* Input          : - Xpos: left column
+*                  - Ypos: top row
+*                  - width, height: size in pixels
+*                  - palette: colours of the image (LCD_RLE_COLORS at most)
+*                  - runs: LCD_RLE_RUN words, row by row
+*                  - count: number of runs
+* Output         : None
+* Return         : None
+* Attention		 : The image must lie entirely on the screen; the text slots it
+*                  covers are forgotten
+*******************************************************************************/
+void LCD_DrawRLE(uint16_t Xpos,uint16_t Ypos,uint16_t width,uint16_t height,const uint16_t *palette,const uint16_t *runs,uint32_t count)
+{
+	uint32_t k, n, seg;
+	uint16_t x = 0, y = 0, color;
+	uint8_t i;
+
+	LCD_LIST_BARRIER();
+	if( Xpos >= MAX_X || Ypos >= MAX_Y || width == 0 || height == 0 ||
+	    width > MAX_X - Xpos || height > MAX_Y - Ypos )
+	{
+		return;
+	}
+	LCD_COST_BEGIN("LCD_DrawRLE");
+#if  ( DISP_ORIENTATION == 0 ) || ( DISP_ORIENTATION == 180 )
+	if( LCD_Code != SSD2119 )
+	{
+		LCD_SetWindow(Xpos, Ypos, Xpos + width - 1, Ypos + height - 1);
+		LCD_WriteIndex(0x0022);
+	}
+#endif
+	for( k = 0; k < count && y < height; k++ )
+	{
+		color = palette[runs[k] >> 12];
+		n = (runs[k] & 0x0FFF) + 1;
+#if  ( DISP_ORIENTATION == 0 ) || ( DISP_ORIENTATION == 180 )
+		if( LCD_Code != SSD2119 )
+		{
+			LCD_WriteDataRepeat(color, n);
+		}
+#endif
+		/* follow the run through the rows for the shadow (and the fallback) */
+		while( n > 0 && y < height )
+		{
+			seg = width - x;
+			if( x == 0 && n >= width )
+			{
+				seg = (n / width) * width;           /* whole rows at once */
+				if( seg / width > (uint32_t)(height - y) )
+				{
+					seg = (uint32_t)(height - y) * width;
+				}
+				LCD_ShadowFill(Xpos, Ypos + y, width, seg / width, color);
+			}
+			else
+			{
+				if( seg > n )
+				{
+					seg = n;
+				}
+				LCD_ShadowFill(Xpos + x, Ypos + y, seg, 1, color);
+			}
+#if  ( DISP_ORIENTATION == 90 ) || ( DISP_ORIENTATION == 270 )
+			if( x == 0 && seg >= width )
+			{
+				LCD_FillRect(Xpos, Ypos + y, width, seg / width, color);
+			}
+			else
+			{
+				LCD_FillRect(Xpos + x, Ypos + y, seg, 1, color);
+			}
+#endif
+			x += seg % width;
+			y += seg / width;
+			if( x >= width )
+			{
+				x -= width;
+				y++;
+			}
+			n -= seg;
+		}
+	}
+#if  ( DISP_ORIENTATION == 0 ) || ( DISP_ORIENTATION == 180 )
+	if( LCD_Code != SSD2119 )
+	{
+		LCD_SetWindow(0, 0, MAX_X - 1, MAX_Y - 1);
+	}
+#endif
+
+	for( i = 0; i < LCD_TEXT_SLOTS; i++ )
+	{
+		if( textSlot[i].y + 16 > Ypos && textSlot[i].y < Ypos + height &&
+		    textSlot[i].x + 8 * textSlot[i].len > Xpos && textSlot[i].x < Xpos + width )
+		{
+			textSlot[i].len = 0;
+		}
+	}
+	LCD_COST_END();
 }
 
 /******************************************************************************
@@ -537,22 +1312,12 @@ void LCD_DrawLine( uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1 , uint16_t
 
     if( dx == 0 )     /* Xû ֱ */ 
     {
-        do
-        { 
-            LCD_SetPoint(x0, y0, color);   /* ʾ 费ֱ */
-            y0++;
-        }
-        while( y1 >= y0 ); 
+        LCD_FillRect(x0, y0, 1, dy + 1, color);   /* vertical line: 1-pixel wide rectangle */
 		return; 
     }
     if( dy == 0 )     /* Yû ˮƽֱ */ 
     {
-        do
-        {
-            LCD_SetPoint(x0, y0, color);   /* ʾ ˮƽ */
-            x0++;
-        }
-        while( x1 >= x0 ); 
+        LCD_FillRect(x0, y0, dx + 1, 1, color);   /* horizontal line: 1-pixel high rectangle */
 		return;
     }
 	/* ɭķ(Bresenham)㷨 */
@@ -612,7 +1377,24 @@ void PutChar( uint16_t Xpos, uint16_t Ypos, uint8_t ASCI, uint16_t charColor, ui
 {
 	uint16_t i, j;
     uint8_t buffer[16], tmp_char;
+    uint16_t pixels[16*8];
+    PROFILE_BEGIN(PROFILE_PUT_CHAR);
     GetASCIICode(buffer,ASCI);  /* ȡģ */
+    if( Xpos + 8 <= MAX_X && Ypos + 16 <= MAX_Y )
+    {
+        /* whole glyph as one 8x16 image, streamed row by row */
+        for( i=0; i<16; i++ )
+        {
+            tmp_char = buffer[i];
+            for( j=0; j<8; j++ )
+            {
+                pixels[i*8 + j] = ( (tmp_char >> (7 - j)) & 0x01 ) ? charColor : bkColor;
+            }
+        }
+        LCD_DrawImage(Xpos, Ypos, 8, 16, pixels);
+        PROFILE_END(PROFILE_PUT_CHAR);
+        return;
+    }
     for( i=0; i<16; i++ )
     {
         tmp_char = buffer[i];
@@ -628,6 +1410,7 @@ void PutChar( uint16_t Xpos, uint16_t Ypos, uint8_t ASCI, uint16_t charColor, ui
             }
         }
     }
+    PROFILE_END(PROFILE_PUT_CHAR);
 }
 
 /******************************************************************************
@@ -667,6 +1450,90 @@ void GUI_Text(uint16_t Xpos, uint16_t Ypos, uint8_t *str,uint16_t Color, uint16_
     while ( *str != 0 );
 }
 
+/******************************************************************************
+* Function Name  : GUI_TextSlot
+* Description    : Draws a single-line string in a text slot. The slot keeps the
+*                  last string drawn at its position, so only the characters that
+*                  changed are blitted again and a shorter string erases the tail.
+* Input          : - slot: slot number, 0 .. LCD_TEXT_SLOTS-1
+*                  - Xpos, Ypos: top-left corner of the first character
+*                  - str: string (truncated to LCD_TEXT_LEN characters)
+*                  - Color: character colour
+*                  - bkColor: background colour
+* Output         : None
+* Return         : None
+* Attention		 : A new position or colour redraws the whole string; LCD_Clear
+*                  forgets every slot. Nothing else may draw over a slot.
+*******************************************************************************/
+void GUI_TextSlot(uint8_t slot, uint16_t Xpos, uint16_t Ypos, uint8_t *str, uint16_t Color, uint16_t bkColor)
+{
+	uint8_t i, old;
+
+	if( slot >= LCD_TEXT_SLOTS )
+	{
+		return;
+	}
+	old = textSlot[slot].len;
+	if( textSlot[slot].x != Xpos || textSlot[slot].y != Ypos ||
+	    textSlot[slot].color != Color || textSlot[slot].bkColor != bkColor )
+	{
+		old = 0;                     /* screen content unknown: redraw every character */
+	}
+
+	for( i = 0; i < LCD_TEXT_LEN && str[i] != 0 && Xpos + 8 * (i + 1) <= MAX_X; i++ )
+	{
+		if( i >= old || textSlot[slot].text[i] != str[i] )
+		{
+			PutChar( Xpos + 8 * i, Ypos, str[i], Color, bkColor );
+			textSlot[slot].text[i] = str[i];
+		}
+	}
+	if( i < old )
+	{
+		LCD_FillRect( Xpos + 8 * i, Ypos, 8 * (old - i), 16, bkColor );
+	}
+
+	textSlot[slot].x = Xpos;
+	textSlot[slot].y = Ypos;
+	textSlot[slot].color = Color;
+	textSlot[slot].bkColor = bkColor;
+	textSlot[slot].len = i;
+}
+
+
+/******************************************************************************
+* Function Name  : GUI_TextSlotSeed
+* Description    : Records a string that is already on the screen (e.g. part of
+*                  an image drawn by LCD_DrawRLE) in a text slot, without drawing
+*                  it: the next GUI_TextSlot on the slot redraws only what changed.
+* Input          : - slot: slot number, 0 .. LCD_TEXT_SLOTS-1
+*                  - Xpos, Ypos: top-left corner of the first character
+*                  - str: string shown (truncated to LCD_TEXT_LEN characters)
+*                  - Color: character colour
+*                  - bkColor: background colour
+* Output         : None
+* Return         : None
+* Attention		 : The string must really be on the screen, as GUI_TextSlot would
+*                  have drawn it
+*******************************************************************************/
+void GUI_TextSlotSeed(uint8_t slot, uint16_t Xpos, uint16_t Ypos, uint8_t *str, uint16_t Color, uint16_t bkColor)
+{
+	uint8_t i;
+
+	if( slot >= LCD_TEXT_SLOTS )
+	{
+		return;
+	}
+	for( i = 0; i < LCD_TEXT_LEN && str[i] != 0 && Xpos + 8 * (i + 1) <= MAX_X; i++ )
+	{
+		textSlot[slot].text[i] = str[i];
+	}
+	textSlot[slot].x = Xpos;
+	textSlot[slot].y = Ypos;
+	textSlot[slot].color = Color;
+	textSlot[slot].bkColor = bkColor;
+	textSlot[slot].len = i;
+}
 
 
 /*********************************************************************************************************
@@ -59,6 +59,16 @@
 
 #endif
 
+/* Text slots (GUI_TextSlot) */
+#define LCD_TEXT_SLOTS    8
+#define LCD_TEXT_LEN      28
+
+/* Run-length encoded images (LCD_DrawRLE): one 16-bit word per run,
+   palette index in the top 4 bits, run length - 1 in the low 12 bits */
+#define LCD_RLE_RUN(index, length)  ( (uint16_t)( ((index) << 12) | ((length) - 1) ) )
+#define LCD_RLE_MAX_RUN             4096
+#define LCD_RLE_COLORS              16
+
 /* LCD color */
 #define White          0xFFFF
 #define Black          0x0000
@@ -90,12 +100,23 @@
 
 /* Private function prototypes -----------------------------------------------*/
 void LCD_Initialization(void);
+void LCD_BusTiming(void);
 void LCD_Clear(uint16_t Color);
 uint16_t LCD_GetPoint(uint16_t Xpos,uint16_t Ypos);
 void LCD_SetPoint(uint16_t Xpos,uint16_t Ypos,uint16_t point);
+void LCD_FillRect(uint16_t Xpos,uint16_t Ypos,uint16_t width,uint16_t height,uint16_t color);
+void LCD_DrawBar(uint16_t Xpos,uint16_t Ypos,uint16_t length,uint16_t thickness,uint8_t vertical,uint16_t color);
+void LCD_DrawImage(uint16_t Xpos,uint16_t Ypos,uint16_t width,uint16_t height,const uint16_t *pixels);
+void LCD_DrawRLE(uint16_t Xpos,uint16_t Ypos,uint16_t width,uint16_t height,const uint16_t *palette,const uint16_t *runs,uint32_t count);
 void LCD_DrawLine( uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1 , uint16_t color );
 void PutChar( uint16_t Xpos, uint16_t Ypos, uint8_t ASCI, uint16_t charColor, uint16_t bkColor );
 void GUI_Text(uint16_t Xpos, uint16_t Ypos, uint8_t *str,uint16_t Color, uint16_t bkColor);
+void GUI_TextSlot(uint8_t slot, uint16_t Xpos, uint16_t Ypos, uint8_t *str, uint16_t Color, uint16_t bkColor);
+void GUI_TextSlotSeed(uint8_t slot, uint16_t Xpos, uint16_t Ypos, uint8_t *str, uint16_t Color, uint16_t bkColor);
+
+#ifdef LCD_TIMING_VERIFY
+extern uint32_t LCD_TimingViolations;   /* bus phases shorter than the controller profile */
+#endif
 
 #endif 
 
@@ -0,0 +1,193 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           LCDCost.c
+** Last modified Date:  2026-10-19
+** Last Version:        V1.00
+** Descriptions:        Bus-cycle cost model of the GLCD driver and per-call rendering budget
+** Correlated files:    LCDCost.h, GLCD.c
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "LCDCost.h"
+
+#ifdef LCD_COST_ENABLE
+
+LCD_CostCounters LCD_Cost;
+LCD_CostZone LCD_CostZones[LCD_COST_ZONES];
+
+static struct{
+	LCD_CostZone *zone;
+	LCD_CostCounters start;
+}costStack[LCD_COST_DEPTH];
+static uint8_t costDepth = 0;
+
+/*******************************************************************************
+* Function Name  : LCD_CostMicroseconds
+* Description    : Converts bus counters into estimated microseconds at LCD_COST_CCLK_MHZ.
+* Input          : - c: counters to convert
+* Output         : None
+* Return         : estimated time in microseconds
+* Attention		 : None
+*******************************************************************************/
+uint32_t LCD_CostMicroseconds(const LCD_CostCounters *c)
+{
+	uint32_t cycles;
+
+	cycles = c->gpio  * LCD_COST_GPIO_CYCLES  +
+	         c->index * LCD_COST_INDEX_CYCLES +
+	         c->data  * LCD_COST_DATA_CYCLES  +
+	         c->burst * LCD_COST_BURST_CYCLES +
+	         c->delay * LCD_COST_DELAY_CYCLES;
+	return cycles / LCD_COST_CCLK_MHZ;
+}
+
+/*******************************************************************************
+* Function Name  : LCD_CostBegin
+* Description    : Opens the budget of a top-level draw call. Calls may nest, each
+*                  zone is charged with everything issued until its LCD_CostEnd.
+* Input          : - name: zone name (string literal, compared by address)
+* Output         : None
+* Return         : None
+* Attention		 : Must be paired with LCD_CostEnd
+*******************************************************************************/
+void LCD_CostBegin(const char *name)
+{
+	uint8_t i;
+	LCD_CostZone *zone = 0;
+
+	for( i = 0; i < LCD_COST_ZONES; i++ )
+	{
+		if( LCD_CostZones[i].name == name || LCD_CostZones[i].name == 0 )
+		{
+			zone = &LCD_CostZones[i];
+			zone->name = name;
+			break;
+		}
+	}
+	if( costDepth < LCD_COST_DEPTH )
+	{
+		costStack[costDepth].zone = zone;
+		costStack[costDepth].start = LCD_Cost;
+	}
+	costDepth++;
+}
+
+/*******************************************************************************
+* Function Name  : LCD_CostEnd
+* Description    : Closes the innermost open zone and charges it with the bus
+*                  activity issued since the matching LCD_CostBegin.
+* Input          : None
+* Output         : None
+* Return         : None
+* Attention		 : None
+*******************************************************************************/
+void LCD_CostEnd(void)
+{
+	LCD_CostZone *zone;
+	LCD_CostCounters d;
+	uint32_t us;
+
+	if( costDepth == 0 )
+	{
+		return;
+	}
+	costDepth--;
+	if( costDepth >= LCD_COST_DEPTH || costStack[costDepth].zone == 0 )
+	{
+		return;
+	}
+	zone = costStack[costDepth].zone;
+
+	d.gpio  = LCD_Cost.gpio  - costStack[costDepth].start.gpio;
+	d.index = LCD_Cost.index - costStack[costDepth].start.index;
+	d.data  = LCD_Cost.data  - costStack[costDepth].start.data;
+	d.burst = LCD_Cost.burst - costStack[costDepth].start.burst;
+	d.delay = LCD_Cost.delay - costStack[costDepth].start.delay;
+	us = LCD_CostMicroseconds(&d);
+
+	zone->calls++;
+	zone->total.gpio  += d.gpio;
+	zone->total.index += d.index;
+	zone->total.data  += d.data;
+	zone->total.burst += d.burst;
+	zone->total.delay += d.delay;
+	zone->usTotal += us;
+	if( us > zone->usMax )
+	{
+		zone->usMax = us;
+	}
+}
+
+/*******************************************************************************
+* Function Name  : LCD_CostReport
+* Description    : Prints the budget of every tracked draw call, ranked by total
+*                  estimated time (Debug (printf) Viewer in the simulator).
+* Input          : None
+* Output         : None
+* Return         : None
+* Attention		 : None
+*******************************************************************************/
+void LCD_CostReport(void)
+{
+	uint8_t order[LCD_COST_ZONES];
+	uint8_t i, j, n = 0, tmp;
+	LCD_CostZone *z;
+
+	for( i = 0; i < LCD_COST_ZONES && LCD_CostZones[i].name != 0; i++ )
+	{
+		order[n++] = i;
+	}
+	/* insertion sort, most expensive first */
+	for( i = 1; i < n; i++ )
+	{
+		tmp = order[i];
+		for( j = i; j > 0 && LCD_CostZones[order[j-1]].usTotal < LCD_CostZones[tmp].usTotal; j-- )
+		{
+			order[j] = order[j-1];
+		}
+		order[j] = tmp;
+	}
+
+	printf("\n--- LCD budget @%dMHz ---------------------------------------------------------\n", LCD_COST_CCLK_MHZ);
+	printf("%-22s %6s %9s %8s %8s %8s %9s %9s %8s %8s\n",
+	       "call", "calls", "gpio", "index", "data", "burst", "delay", "tot[us]", "avg[us]", "max[us]");
+	for( i = 0; i < n; i++ )
+	{
+		z = &LCD_CostZones[order[i]];
+		printf("%-22s %6u %9u %8u %8u %8u %9u %9u %8u %8u\n",
+		       z->name, z->calls, z->total.gpio, z->total.index, z->total.data, z->total.burst, z->total.delay,
+		       z->usTotal, z->usTotal / z->calls, z->usMax);
+	}
+	printf("%-22s %6s %9u %8u %8u %8u %9u %9u\n", "all bus traffic", "",
+	       LCD_Cost.gpio, LCD_Cost.index, LCD_Cost.data, LCD_Cost.burst, LCD_Cost.delay, LCD_CostMicroseconds(&LCD_Cost));
+}
+
+/*******************************************************************************
+* Function Name  : LCD_CostReset
+* Description    : Clears counters and zones.
+* Input          : None
+* Output         : None
+* Return         : None
+* Attention		 : Do not call while a zone is open
+*******************************************************************************/
+void LCD_CostReset(void)
+{
+	memset(&LCD_Cost, 0, sizeof(LCD_Cost));
+	memset(LCD_CostZones, 0, sizeof(LCD_CostZones));
+	costDepth = 0;
+}
+
+#else
+
+void LCD_CostBegin(const char *name) {}
+void LCD_CostEnd(void) {}
+uint32_t LCD_CostMicroseconds(const LCD_CostCounters *c) { return 0; }
+void LCD_CostReport(void) {}
+void LCD_CostReset(void) {}
+
+#endif
+
+/******************************************************************************
+**                            End Of File
+******************************************************************************/
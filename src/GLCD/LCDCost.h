@@ -0,0 +1,90 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           LCDCost.h
+** Last modified Date:  2026-10-19
+** Last Version:        V1.00
+** Descriptions:        Bus-cycle cost model of the GLCD driver and per-call rendering budget
+** Correlated files:    LCDCost.c, GLCD.c
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#ifndef __LCDCOST_H
+#define __LCDCOST_H
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Private define ------------------------------------------------------------*/
+
+/* Accounting is compiled in the simulator target only */
+#ifdef SIMULATOR
+#define LCD_COST_ENABLE
+#endif
+
+/* Cost model: estimated core cycles of each bus primitive on a 100 MHz LPC1768 */
+#define LCD_COST_CCLK_MHZ       100
+#define LCD_COST_GPIO_CYCLES    3    /* one store to FIODIR/FIOSET/FIOCLR/FIOPIN (address load + str) */
+#define LCD_COST_DELAY_CYCLES   4    /* one iteration of wait_delay/delay_ms                           */
+#define LCD_COST_INDEX_CYCLES   10   /* call overhead of one index (RS=0) transaction                  */
+#define LCD_COST_DATA_CYCLES    10   /* call overhead of one data (RS=1) write or read transaction     */
+#define LCD_COST_BURST_CYCLES   2    /* loop overhead of one pixel inside a data burst                 */
+
+#define LCD_COST_ZONES          16   /* max number of distinct top-level draw calls tracked            */
+#define LCD_COST_DEPTH          8    /* max nesting of LCD_COST_BEGIN/LCD_COST_END                      */
+
+/* Private typedef -----------------------------------------------------------*/
+
+/*******************************************************************************
+**   Counters of the bus activity generated by the driver.
+********************************************************************************/
+typedef struct{
+	uint32_t gpio;      /* GPIO register writes                   */
+	uint32_t index;     /* index (register address) transactions  */
+	uint32_t data;      /* data write/read transactions           */
+	uint32_t burst;     /* pixels streamed inside data bursts     */
+	uint32_t delay;     /* busy-wait loop iterations              */
+}LCD_CostCounters;
+
+/*******************************************************************************
+**   Budget of a single top-level draw call, identified by its name.
+********************************************************************************/
+typedef struct{
+	const char *name;
+	uint32_t calls;
+	LCD_CostCounters total;
+	uint32_t usTotal;
+	uint32_t usMax;
+}LCD_CostZone;
+
+/* Private variables ---------------------------------------------------------*/
+#ifdef LCD_COST_ENABLE
+extern LCD_CostCounters LCD_Cost;
+extern LCD_CostZone LCD_CostZones[LCD_COST_ZONES];
+
+#define LCD_COST_GPIO(n)      (LCD_Cost.gpio  += (n))
+#define LCD_COST_INDEX()      (LCD_Cost.index++)
+#define LCD_COST_DATA()       (LCD_Cost.data++)
+#define LCD_COST_BURST(n)     (LCD_Cost.burst += (n))
+#define LCD_COST_DELAY(n)     (LCD_Cost.delay += (n))
+#define LCD_COST_BEGIN(name)  LCD_CostBegin(name)
+#define LCD_COST_END()        LCD_CostEnd()
+#else
+#define LCD_COST_GPIO(n)
+#define LCD_COST_INDEX()
+#define LCD_COST_DATA()
+#define LCD_COST_BURST(n)
+#define LCD_COST_DELAY(n)
+#define LCD_COST_BEGIN(name)
+#define LCD_COST_END()
+#endif
+
+/* Private function prototypes -----------------------------------------------*/
+void LCD_CostBegin(const char *name);
+void LCD_CostEnd(void);
+uint32_t LCD_CostMicroseconds(const LCD_CostCounters *c);
+void LCD_CostReport(void);
+void LCD_CostReset(void);
+
+#endif /* end __LCDCOST_H */
+/*****************************************************************************
+**                            End Of File
+******************************************************************************/
@@ -0,0 +1,351 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           LCDList.c
+** Last modified Date:  2026-10-19
+** Last Version:        V1.00
+** Descriptions:        Display list of the GLCD driver. Between LCD_ListBegin and LCD_ListEnd the
+**                      rectangle fills (and single points) are recorded instead of being sent.
+**                      On flush the recorded fills are grouped into dirty rectangles, every pixel
+**                      of a dirty rectangle is resolved to its final colour (last fill covering it)
+**                      and compared with the shadow: only the pixels that change go over the bus,
+**                      once, through window bursts.
+** Correlated files:    LCDList.h, GLCD.c, LCDShadow.c
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#include <string.h>
+#include "GLCD.h"
+#include "LCDList.h"
+#include "LCDShadow.h"
+#include "LCDCost.h"
+
+/* Private define ------------------------------------------------------------*/
+#define PIXEL_UNKNOWN   0     /* not covered by the list and not in the shadow */
+#define PIXEL_KEEP      1     /* the screen already shows the final colour      */
+#define PIXEL_SEND      2     /* the final colour has to be sent                */
+
+/* Private variables ---------------------------------------------------------*/
+uint8_t LCD_ListDepth = 0;
+
+static LCD_ListEntry listEntry[LCD_LIST_SIZE];
+static uint8_t listCount = 0;
+
+static struct{
+	uint16_t x0, y0, x1, y1;           /* x1, y1 excluded */
+}listDirty[LCD_LIST_SIZE];
+
+static uint16_t listPixel[LCD_LIST_SCRATCH];
+static uint16_t listColumn[MAX_Y];
+static uint8_t listState[LCD_LIST_SCRATCH];
+
+/*******************************************************************************
+* Function Name  : LCD_ListBegin
+* Description    : Starts recording. Calls may nest, the list is flushed by the
+*                  outermost LCD_ListEnd.
+* Input          : None
+* Output         : None
+* Return         : None
+* Attention		 : Must be paired with LCD_ListEnd
+*******************************************************************************/
+void LCD_ListBegin(void)
+{
+	LCD_ListDepth++;
+}
+
+/*******************************************************************************
+* Function Name  : LCD_ListEnd
+* Description    : Stops recording; the outermost call flushes the list.
+* Input          : None
+* Output         : None
+* Return         : None
+* Attention		 : None
+*******************************************************************************/
+void LCD_ListEnd(void)
+{
+	if( LCD_ListDepth == 0 )
+	{
+		return;
+	}
+	if( LCD_ListDepth == 1 )
+	{
+		LCD_ListFlush();
+	}
+	LCD_ListDepth--;
+}
+
+/*******************************************************************************
+* Function Name  : LCD_ListRecord
+* Description    : Appends a fill to the list. Earlier fills entirely hidden by the
+*                  new one are dropped; a full list is flushed first.
+* Input          : - Xpos, Ypos: top-left corner
+*                  - width, height: size in pixels, already clipped to the screen
+*                  - color: fill colour
+* Output         : None
+* Return         : 1 (the fill has been recorded)
+* Attention		 : Called by the driver through LCD_LIST_RECORD only
+*******************************************************************************/
+uint8_t LCD_ListRecord(uint16_t Xpos, uint16_t Ypos, uint16_t width, uint16_t height, uint16_t color)
+{
+	uint8_t i, n = 0;
+	LCD_ListEntry *e;
+
+	for( i = 0; i < listCount; i++ )
+	{
+		e = &listEntry[i];
+		if( e->x >= Xpos && e->y >= Ypos && e->x + e->w <= Xpos + width && e->y + e->h <= Ypos + height )
+		{
+			continue;                        /* overdrawn: never reaches the bus */
+		}
+		listEntry[n++] = *e;
+	}
+	listCount = n;
+	if( listCount == LCD_LIST_SIZE )
+	{
+		LCD_ListFlush();
+	}
+
+	e = &listEntry[listCount++];
+	e->x = Xpos;
+	e->y = Ypos;
+	e->w = width;
+	e->h = height;
+	e->color = color;
+	return 1;
+}
+
+/*******************************************************************************
+* Function Name  : LCD_ListSend
+* Description    : Sends the changed pixels of a resolved band of rows. If every
+*                  pixel of the bounding box of the changes has a known colour the
+*                  box is sent as one window burst (a strip at most two pixels
+*                  wide as column streams), otherwise each row run of changed
+*                  pixels is sent on its own.
+* Input          : - x0, y0: screen position of the band
+*                  - w, h: band size (listPixel/listState, row by row)
+* Output         : None
+* Return         : None
+* Attention		 : None
+*******************************************************************************/
+static void LCD_ListSend(uint16_t x0, uint16_t y0, uint16_t w, uint16_t h)
+{
+	uint16_t r, c, k, bx0 = w, bx1 = 0, by0 = h, by1 = 0, run;
+	uint8_t gaps = 0;
+
+	for( r = 0; r < h; r++ )
+	{
+		for( c = 0; c < w; c++ )
+		{
+			if( listState[r * w + c] == PIXEL_SEND )
+			{
+				if( c < bx0 ) bx0 = c;
+				if( c >= bx1 ) bx1 = c + 1;
+				if( r < by0 ) by0 = r;
+				by1 = r + 1;
+			}
+		}
+	}
+	if( bx1 == 0 )
+	{
+		return;                              /* nothing changed */
+	}
+
+	for( r = by0; r < by1 && !gaps; r++ )
+	{
+		for( c = bx0; c < bx1; c++ )
+		{
+			if( listState[r * w + c] == PIXEL_UNKNOWN )
+			{
+				gaps = 1;
+				break;
+			}
+		}
+	}
+
+	if( !gaps && bx1 - bx0 <= 2 && by1 - by0 > 2 )
+	{
+		/* thin vertical strip (a vertical wall): one column stream each */
+		for( c = bx0; c < bx1; c++ )
+		{
+			for( r = by0; r < by1; r++ )
+			{
+				listColumn[r - by0] = listPixel[r * w + c];
+			}
+			LCD_DrawImage(x0 + c, y0 + by0, 1, by1 - by0, listColumn);
+		}
+		return;
+	}
+	if( !gaps )
+	{
+		/* compact the bounding box at the start of the buffer (never overtakes the reads) */
+		k = 0;
+		for( r = by0; r < by1; r++ )
+		{
+			for( c = bx0; c < bx1; c++ )
+			{
+				listPixel[k++] = listPixel[r * w + c];
+			}
+		}
+		LCD_DrawImage(x0 + bx0, y0 + by0, bx1 - bx0, by1 - by0, listPixel);
+		return;
+	}
+
+	for( r = by0; r < by1; r++ )
+	{
+		for( c = bx0; c < bx1; c += run )
+		{
+			for( run = 0; c + run < bx1 && listState[r * w + c + run] == PIXEL_SEND; run++ );
+			if( run > 0 )
+			{
+				LCD_DrawImage(x0 + c, y0 + r, run, 1, &listPixel[r * w + c]);
+			}
+			else
+			{
+				run = 1;
+			}
+		}
+	}
+}
+
+/*******************************************************************************
+* Function Name  : LCD_ListResolve
+* Description    : Resolves a dirty rectangle to final colours, in bands of rows
+*                  that fit the scratch buffer, and sends what changed.
+* Input          : - d: dirty rectangle index
+* Output         : None
+* Return         : None
+* Attention		 : None
+*******************************************************************************/
+static void LCD_ListResolve(uint8_t d)
+{
+	uint16_t x0 = listDirty[d].x0, x1 = listDirty[d].x1;
+	uint16_t w = x1 - x0, rows = LCD_LIST_SCRATCH / w;
+	uint16_t y, y1, h, ex0, ex1, ey0, ey1, r, c, current;
+	uint8_t i, *state;
+	LCD_ListEntry *e;
+
+	for( y = listDirty[d].y0; y < listDirty[d].y1; y += h )
+	{
+		h = listDirty[d].y1 - y;
+		if( h > rows )
+		{
+			h = rows;
+		}
+		y1 = y + h;
+		memset(listState, PIXEL_UNKNOWN, w * h);
+
+		/* painter's order: the last fill covering a pixel wins */
+		for( i = 0; i < listCount; i++ )
+		{
+			e = &listEntry[i];
+			ex0 = e->x > x0 ? e->x : x0;
+			ey0 = e->y > y ? e->y : y;
+			ex1 = e->x + e->w < x1 ? e->x + e->w : x1;
+			ey1 = e->y + e->h < y1 ? e->y + e->h : y1;
+			for( r = ey0; r < ey1; r++ )
+			{
+				for( c = ex0; c < ex1; c++ )
+				{
+					listPixel[(r - y) * w + (c - x0)] = e->color;
+					listState[(r - y) * w + (c - x0)] = PIXEL_SEND;
+				}
+			}
+		}
+
+		/* drop what the screen already shows */
+		for( r = 0; r < h; r++ )
+		{
+			for( c = 0; c < w; c++ )
+			{
+				state = &listState[r * w + c];
+				if( LCD_ShadowLookup(x0 + c, y + r, &current) )
+				{
+					if( *state == PIXEL_UNKNOWN )
+					{
+						listPixel[r * w + c] = current;
+						*state = PIXEL_KEEP;
+					}
+					else if( listPixel[r * w + c] == current )
+					{
+						*state = PIXEL_KEEP;
+					}
+				}
+			}
+		}
+
+		LCD_ListSend(x0, y, w, h);
+	}
+}
+
+/*******************************************************************************
+* Function Name  : LCD_ListFlush
+* Description    : Groups the recorded fills into dirty rectangles and sends the
+*                  final image of each one. Two rectangles are merged when their
+*                  bounding box wastes at most LCD_LIST_SLACK pixels; rectangles
+*                  may still overlap, a pixel sent once is then already up to date.
+* Input          : None
+* Output         : None
+* Return         : None
+* Attention		 : Recording stays active, the list is emptied
+*******************************************************************************/
+void LCD_ListFlush(void)
+{
+	uint8_t depth = LCD_ListDepth, i, j, n, merged;
+	uint16_t ux0, uy0, ux1, uy1;
+	uint32_t areaI, areaJ, areaU;
+
+	if( listCount == 0 )
+	{
+		return;
+	}
+	LCD_COST_BEGIN("LCD_ListFlush");
+	LCD_ListDepth = 0;                       /* the driver draws for real from here */
+
+	for( i = 0; i < listCount; i++ )
+	{
+		listDirty[i].x0 = listEntry[i].x;
+		listDirty[i].y0 = listEntry[i].y;
+		listDirty[i].x1 = listEntry[i].x + listEntry[i].w;
+		listDirty[i].y1 = listEntry[i].y + listEntry[i].h;
+	}
+	n = listCount;
+	do
+	{
+		merged = 0;
+		for( i = 0; i < n; i++ )
+		{
+			for( j = i + 1; j < n; )
+			{
+				ux0 = listDirty[i].x0 < listDirty[j].x0 ? listDirty[i].x0 : listDirty[j].x0;
+				uy0 = listDirty[i].y0 < listDirty[j].y0 ? listDirty[i].y0 : listDirty[j].y0;
+				ux1 = listDirty[i].x1 > listDirty[j].x1 ? listDirty[i].x1 : listDirty[j].x1;
+				uy1 = listDirty[i].y1 > listDirty[j].y1 ? listDirty[i].y1 : listDirty[j].y1;
+				areaI = (uint32_t)(listDirty[i].x1 - listDirty[i].x0) * (listDirty[i].y1 - listDirty[i].y0);
+				areaJ = (uint32_t)(listDirty[j].x1 - listDirty[j].x0) * (listDirty[j].y1 - listDirty[j].y0);
+				areaU = (uint32_t)(ux1 - ux0) * (uy1 - uy0);
+				if( areaU <= areaI + areaJ + LCD_LIST_SLACK )
+				{
+					listDirty[i].x0 = ux0; listDirty[i].y0 = uy0;
+					listDirty[i].x1 = ux1; listDirty[i].y1 = uy1;
+					listDirty[j] = listDirty[--n];
+					merged = 1;
+				}
+				else
+				{
+					j++;
+				}
+			}
+		}
+	}
+	while( merged );
+
+	for( i = 0; i < n; i++ )
+	{
+		LCD_ListResolve(i);
+	}
+	listCount = 0;
+	LCD_ListDepth = depth;
+	LCD_COST_END();
+}
+
+/******************************************************************************
+**                            End Of File
+******************************************************************************/
@@ -0,0 +1,48 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           LCDList.h
+** Last modified Date:  2026-10-19
+** Last Version:        V1.00
+** Descriptions:        Display list of the GLCD driver: rectangle fills recorded during a frame and
+**                      flushed once, sending only the final colour of the pixels that change
+** Correlated files:    LCDList.c, GLCD.c, LCDShadow.c
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#ifndef __LCDLIST_H
+#define __LCDLIST_H
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Private define ------------------------------------------------------------*/
+#define LCD_LIST_SIZE       96    /* recorded fills per flush, a full list is flushed early   */
+#define LCD_LIST_SCRATCH    512   /* pixels resolved at a time (rows of one dirty rectangle)   */
+#define LCD_LIST_SLACK      64    /* pixels two dirty rectangles may waste when merged          */
+
+/* Private typedef -----------------------------------------------------------*/
+
+/*******************************************************************************
+**   One recorded fill, in screen coordinates (already clipped by the driver).
+********************************************************************************/
+typedef struct{
+	uint16_t x, y, w, h;
+	uint16_t color;
+}LCD_ListEntry;
+
+/* Private variables ---------------------------------------------------------*/
+extern uint8_t LCD_ListDepth;
+
+/* Driver hooks: record instead of drawing, flush before anything not recorded */
+#define LCD_LIST_RECORD(x, y, w, h, color)  ( LCD_ListDepth != 0 && LCD_ListRecord(x, y, w, h, color) )
+#define LCD_LIST_BARRIER()                  { if( LCD_ListDepth != 0 ) LCD_ListFlush(); }
+
+/* Private function prototypes -----------------------------------------------*/
+void LCD_ListBegin(void);
+void LCD_ListEnd(void);
+uint8_t LCD_ListRecord(uint16_t Xpos, uint16_t Ypos, uint16_t width, uint16_t height, uint16_t color);
+void LCD_ListFlush(void);
+
+#endif /* end __LCDLIST_H */
+/*****************************************************************************
+**                            End Of File
+******************************************************************************/
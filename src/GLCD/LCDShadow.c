@@ -0,0 +1,239 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           LCDShadow.c
+** Last modified Date:  2026-10-19
+** Last Version:        V1.00
+** Descriptions:        Palette-indexed 4 bpp RAM copy of the board region of the screen. The GLCD
+**                      driver keeps it up to date on every write, so that a region can be restored
+**                      from RAM by sending only the pixels whose colour actually changes, without
+**                      reading the GRAM back.
+** Correlated files:    LCDShadow.h, GLCD.c, LCDList.c
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#include <string.h>
+#include "GLCD.h"
+#include "LCDShadow.h"
+
+/* Private define ------------------------------------------------------------*/
+#if defined ( __CC_ARM )
+/* 224*112 bytes: placed at the start of the AHB SRAM (IRAM2), IRAM1 holds stack and heap */
+#define LCD_SHADOW_SECTION  __attribute__((at(0x2007C000), zero_init))
+#else
+#define LCD_SHADOW_SECTION
+#endif
+
+/* Private variables ---------------------------------------------------------*/
+uint8_t LCD_Shadow[LCD_SHADOW_H][LCD_SHADOW_STRIDE] LCD_SHADOW_SECTION;
+
+static const uint16_t shadowPalette[LCD_SHADOW_COLORS] = {
+	Sand, Black, White, Red, Blue, Cyan, Magenta, DarkGrey, Grey, Blue2, Green, Yellow
+};
+
+static uint16_t lastColor = Sand;
+static uint8_t lastIndex = 0;
+
+/*******************************************************************************
+* Function Name  : LCD_ShadowIndex
+* Description    : Palette index of a colour. The last lookup is cached, since
+*                  the driver stores long runs of the same colour.
+* Input          : - color: RGB565 colour
+* Output         : None
+* Return         : palette index, LCD_SHADOW_UNKNOWN if not in the palette
+* Attention		 : None
+*******************************************************************************/
+static uint8_t LCD_ShadowIndex(uint16_t color)
+{
+	uint8_t i;
+
+	if( color == lastColor )
+	{
+		return lastIndex;
+	}
+	for( i = 0; i < LCD_SHADOW_COLORS; i++ )
+	{
+		if( shadowPalette[i] == color )
+		{
+			break;
+		}
+	}
+	if( i == LCD_SHADOW_COLORS )
+	{
+		return LCD_SHADOW_UNKNOWN;
+	}
+	lastColor = color;
+	lastIndex = i;
+	return i;
+}
+
+/*******************************************************************************
+* Function Name  : LCD_ShadowClip
+* Description    : Clips a rectangle to the shadowed region and converts it to
+*                  shadow coordinates.
+* Input          : - x, y: top-left corner, screen coordinates (updated)
+*                  - w, h: size in pixels (updated)
+* Output         : None
+* Return         : 0 if the rectangle is outside the region
+* Attention		 : None
+*******************************************************************************/
+static uint8_t LCD_ShadowClip(uint16_t *x, uint16_t *y, uint16_t *w, uint16_t *h)
+{
+	int16_t x0 = (int16_t)*x - LCD_SHADOW_X0, y0 = (int16_t)*y - LCD_SHADOW_Y0;
+	int16_t x1 = x0 + (int16_t)*w, y1 = y0 + (int16_t)*h;
+
+	if( x0 < 0 ) x0 = 0;
+	if( y0 < 0 ) y0 = 0;
+	if( x1 > LCD_SHADOW_W ) x1 = LCD_SHADOW_W;
+	if( y1 > LCD_SHADOW_H ) y1 = LCD_SHADOW_H;
+	if( x0 >= x1 || y0 >= y1 )
+	{
+		return 0;
+	}
+	*x = x0; *y = y0;
+	*w = x1 - x0; *h = y1 - y0;
+	return 1;
+}
+
+/*******************************************************************************
+* Function Name  : LCD_ShadowInvalidate
+* Description    : Marks every shadowed pixel as unknown (GRAM content after reset).
+* Input          : None
+* Output         : None
+* Return         : None
+* Attention		 : None
+*******************************************************************************/
+void LCD_ShadowInvalidate(void)
+{
+	memset(LCD_Shadow, (LCD_SHADOW_UNKNOWN << 4) | LCD_SHADOW_UNKNOWN, sizeof(LCD_Shadow));
+}
+
+/*******************************************************************************
+* Function Name  : LCD_ShadowStore
+* Description    : Records the colour written to one pixel.
+* Input          : - Xpos, Ypos: screen coordinates
+*                  - color: colour sent to the GRAM
+* Output         : None
+* Return         : None
+* Attention		 : Pixels outside the region are ignored
+*******************************************************************************/
+void LCD_ShadowStore(uint16_t Xpos, uint16_t Ypos, uint16_t color)
+{
+	uint8_t *cell;
+
+	Xpos -= LCD_SHADOW_X0;
+	Ypos -= LCD_SHADOW_Y0;
+	if( Xpos >= LCD_SHADOW_W || Ypos >= LCD_SHADOW_H )
+	{
+		return;
+	}
+	cell = &LCD_Shadow[Ypos][Xpos >> 1];
+	if( Xpos & 1 )
+	{
+		*cell = (*cell & 0x0F) | (LCD_ShadowIndex(color) << 4);
+	}
+	else
+	{
+		*cell = (*cell & 0xF0) | LCD_ShadowIndex(color);
+	}
+}
+
+/*******************************************************************************
+* Function Name  : LCD_ShadowFill
+* Description    : Records a rectangle filled with one colour.
+* Input          : - Xpos, Ypos: top-left corner, screen coordinates
+*                  - width, height: size in pixels
+*                  - color: fill colour
+* Output         : None
+* Return         : None
+* Attention		 : The part outside the region is ignored
+*******************************************************************************/
+void LCD_ShadowFill(uint16_t Xpos, uint16_t Ypos, uint16_t width, uint16_t height, uint16_t color)
+{
+	uint8_t index, pair, *row;
+	uint16_t x, x1, pairs;
+
+	if( !LCD_ShadowClip(&Xpos, &Ypos, &width, &height) )
+	{
+		return;
+	}
+	index = LCD_ShadowIndex(color);
+	pair = (index << 4) | index;
+	x1 = Xpos + width;
+
+	for( ; height > 0; height--, Ypos++ )
+	{
+		row = LCD_Shadow[Ypos];
+		x = Xpos;
+		if( x & 1 )                               /* leading odd column: high nibble */
+		{
+			row[x >> 1] = (row[x >> 1] & 0x0F) | (index << 4);
+			x++;
+		}
+		pairs = (x < x1) ? (x1 - x) >> 1 : 0;
+		memset(&row[x >> 1], pair, pairs);
+		x += pairs * 2;
+		if( x < x1 )                              /* trailing even column: low nibble */
+		{
+			row[x >> 1] = (row[x >> 1] & 0xF0) | index;
+		}
+	}
+}
+
+/*******************************************************************************
+* Function Name  : LCD_ShadowBlit
+* Description    : Records a rectangle of individual pixels (e.g. a glyph).
+* Input          : - Xpos, Ypos: top-left corner, screen coordinates
+*                  - width, height: size in pixels
+*                  - pixels: colours, row by row
+* Output         : None
+* Return         : None
+* Attention		 : None
+*******************************************************************************/
+void LCD_ShadowBlit(uint16_t Xpos, uint16_t Ypos, uint16_t width, uint16_t height, const uint16_t *pixels)
+{
+	uint16_t i, j;
+
+	if( Xpos + width <= LCD_SHADOW_X0 || Xpos >= LCD_SHADOW_X0 + LCD_SHADOW_W ||
+	    Ypos + height <= LCD_SHADOW_Y0 || Ypos >= LCD_SHADOW_Y0 + LCD_SHADOW_H )
+	{
+		return;
+	}
+	for( i = 0; i < height; i++ )
+	{
+		for( j = 0; j < width; j++ )
+		{
+			LCD_ShadowStore(Xpos + j, Ypos + i, pixels[i * width + j]);
+		}
+	}
+}
+
+/*******************************************************************************
+* Function Name  : LCD_ShadowLookup
+* Description    : Colour currently shown by one pixel, as far as the shadow knows.
+* Input          : - Xpos, Ypos: screen coordinates
+* Output         : - color: the pixel colour, when known
+* Return         : 1 if the colour is known, 0 otherwise
+* Attention		 : None
+*******************************************************************************/
+uint8_t LCD_ShadowLookup(uint16_t Xpos, uint16_t Ypos, uint16_t *color)
+{
+	uint8_t index;
+
+	Xpos -= LCD_SHADOW_X0;
+	Ypos -= LCD_SHADOW_Y0;
+	if( Xpos >= LCD_SHADOW_W || Ypos >= LCD_SHADOW_H )
+	{
+		return 0;
+	}
+	index = LCD_Shadow[Ypos][Xpos >> 1];
+	index = ( Xpos & 1 ) ? (index >> 4) : (index & 0x0F);
+	if( index >= LCD_SHADOW_COLORS )
+	{
+		return 0;
+	}
+	*color = shadowPalette[index];
+	return 1;
+}
+
+/******************************************************************************
+**                            End Of File
+******************************************************************************/
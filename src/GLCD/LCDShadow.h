@@ -0,0 +1,41 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           LCDShadow.h
+** Last modified Date:  2026-10-19
+** Last Version:        V1.00
+** Descriptions:        Palette-indexed 4 bpp RAM copy of the board region of the screen
+** Correlated files:    LCDShadow.c, GLCD.c
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#ifndef __LCDSHADOW_H
+#define __LCDSHADOW_H
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Private define ------------------------------------------------------------*/
+
+/* Shadowed region, in screen coordinates: the 7x7 board spans [10, 228) on both axes */
+#define LCD_SHADOW_X0         8
+#define LCD_SHADOW_Y0         8
+#define LCD_SHADOW_W          224
+#define LCD_SHADOW_H          224
+#define LCD_SHADOW_STRIDE     (LCD_SHADOW_W / 2)     /* two pixels per byte, even column in the low nibble */
+
+#define LCD_SHADOW_COLORS     12                     /* entries of the palette (the GLCD.h colours)          */
+#define LCD_SHADOW_UNKNOWN    0x0F                   /* pixel never written, or colour outside the palette   */
+
+/* Private variables ---------------------------------------------------------*/
+extern uint8_t LCD_Shadow[LCD_SHADOW_H][LCD_SHADOW_STRIDE];
+
+/* Private function prototypes -----------------------------------------------*/
+void LCD_ShadowInvalidate(void);
+void LCD_ShadowStore(uint16_t Xpos, uint16_t Ypos, uint16_t color);
+void LCD_ShadowFill(uint16_t Xpos, uint16_t Ypos, uint16_t width, uint16_t height, uint16_t color);
+void LCD_ShadowBlit(uint16_t Xpos, uint16_t Ypos, uint16_t width, uint16_t height, const uint16_t *pixels);
+uint8_t LCD_ShadowLookup(uint16_t Xpos, uint16_t Ypos, uint16_t *color);
+
+#endif /* end __LCDSHADOW_H */
+/*****************************************************************************
+**                            End Of File
+******************************************************************************/
@@ -9,281 +9,156 @@
 *********************************************************************************************************/
 #include "lpc17xx.h"
 #include "RIT.h"
-#include "../GLCD/GLCD.h"
-#include "../quoridor.h"
+#include "../event/event.h"
+#include "../timer/timer.h"
+#include <stdio.h>
 
-volatile int down_I0=0, down_K1=0, down_K2=0;
-extern int gameOn;
-extern int next;
-extern Player player[2];
-extern uint8_t activePlayer;
-extern Box board[7][7];
+#define JOYSTICK_PINS  (0x1F<<25)      /* P1.25...P1.29, low when pressed: INPUT_SELECT...INPUT_UP */
+#define BUTTON_PINS    (0x07<<10)      /* P2.10...P2.12, low when pressed: INPUT_INT0...INPUT_KEY2 */
+
+/* Actions of an input */
+#define ON_PRESS       1
+#define ON_RELEASE     2
+
+/* Per-input actions, by INPUT_*. Auto-repeat in RIT ticks while held, 0: none */
+static const struct{
+	uint8_t events;                     /* ON_PRESS, ON_RELEASE                 */
+	uint8_t delay;                      /* first EVENT_REPEAT after the press   */
+	uint8_t rate;                       /* then one every rate ticks            */
+	int8_t eint;                        /* EINT line of a button, -1: joystick  */
+}inputAction[8] = {
+	{ ON_PRESS, 0, 0, -1 },                                         /* SELECT: confirm once */
+	{ ON_PRESS, 500 / RIT_TICK_MS, 150 / RIT_TICK_MS, -1 },         /* DOWN   */
+	{ ON_PRESS, 500 / RIT_TICK_MS, 150 / RIT_TICK_MS, -1 },         /* LEFT   */
+	{ ON_PRESS, 500 / RIT_TICK_MS, 150 / RIT_TICK_MS, -1 },         /* RIGHT  */
+	{ ON_PRESS, 500 / RIT_TICK_MS, 150 / RIT_TICK_MS, -1 },         /* UP     */
+	{ ON_PRESS, 0, 0, 0 },                                          /* INT0   */
+	{ ON_PRESS, 0, 0, 1 },                                          /* KEY1   */
+	{ ON_PRESS, 0, 0, 2 }                                           /* KEY2   */
+};
+
+/* Buttons switched from EINT to GPIO by their edge (IRQ_button.c), bit = INPUT_* */
+volatile uint8_t inputGpio = 0;
+
+/* Debounced state (1 = pressed) and 1-bit vertical counter of the releases */
+static uint8_t inputState = 0;
+static uint8_t cnt0 = 0;
+
+#ifdef SIMULATOR
+/* Input statistics of the simulator target (Watch window, RIT_report) */
+volatile uint32_t ritWakeups = 0;       /* RIT interrupts                                     */
+volatile uint32_t ritIdle = 0;          /* RIT interrupts with no input pressed or debouncing */
+volatile uint32_t buttonEdge[3];        /* timebase at the EINT0..2 edge (IRQ_button.c)       */
+static uint32_t latCount = 0, latSum = 0, latMin = 0xFFFFFFFF, latMax = 0;
+
+static void buttonLatency(uint8_t button){
+	uint32_t d = read_timebase() - buttonEdge[button];
+	latCount++;
+	latSum += d;
+	if(d < latMin) latMin = d;
+	if(d > latMax) latMax = d;
+}
+#define BUTTON_LATENCY(i)  { if(inputAction[i].eint >= 0) buttonLatency(inputAction[i].eint); }
+#else
+#define BUTTON_LATENCY(i)
+#endif
 
 /******************************************************************************
 ** Function name:		RIT_IRQHandler
 **
 ** Descriptions:		REPETITIVE INTERRUPT TIMER handler
-**									Gestisce il debouncing e lelaborazione dei dati di pulsanti e joystick. In particolare:
-**										-	INT0: inizia il gioco (startGame)
-**										-	KEY1: piazzamento muro in posizione centrale, stampa warning se nessun muro  disponibile. 
-**										  Cliccarlo una seconda volta riporta il giocatore alla movimentazione del token.
-**										-	KEY2: Se in modalit piazzamento muro, lo fa ruotare di 90.
-**										-	Joystick UP/DOWN/LEFT/RIGHT: verifica che il comando richiesto sia conforme alle direzioni accettabili 
-**										  calcolate per il giocatore attivo (updatePlayerState) e invia lesecuzione temporanea della mossa (executeMove).
-**										-	Joystick SELECT: in caso di movimentazione token conferma lultima mossa (executeMove) eseguita con 
-**										  successo tramite Joystick UP/DOWN/LEFT/RIGHT. In caso di piazzamento muro prima di confermare la mossa (executeMove) 
-**											verifica che il suo inserimento non causi sovrapposizioni con altri muri (checkWallPosition) o trappole (checkTrap).
+**									Debouncing di joystick e pulsanti: FIOPIN1 e FIOPIN2 sono letti una 
+**									sola volta e gli otto ingressi sono filtrati in parallelo: una pressione 
+**									vale dal primo campione, un rilascio dopo 2 campioni uguali (contatore 
+**									verticale a 1 bit), cos un rimbalzo mentre  tenuto premuto non diventa 
+**									un rilascio e una nuova pressione. 
+**									Dalla tabella inputAction ogni ingresso inserisce nella coda (event_put) 
+**									gli eventi EVENT_PRESS, EVENT_RELEASE ed EVENT_REPEAT (tenuto premuto). 
+**									Al rilascio i pulsanti tornano in modalit EINT. Le azioni di gioco sono 
+**									eseguite dal main loop (handleEvent), fuori dall'interrupt.
+**									Il RIT viene avviato dal fronte di un pulsante (wake_RIT) o dalla partita 
+**									per campionare il joystick (poll_joystick) e si ferma da solo quando non 
+**									serve pi.
 **
 ** parameters:			None
 ** Returned value:		None
 **
 ******************************************************************************/
 void RIT_IRQHandler (void){					
-	static int J_select=0;
-	static int J_down = 0;
-	static int J_left = 0;
-	static int J_right = 0;
-	static int J_up = 0;
+	static uint8_t repeat[8];
+	uint32_t p1 = LPC_GPIO1->FIOPIN, p2 = LPC_GPIO2->FIOPIN;
+	uint8_t raw, delta, toggle, rearm, bit, i;
 	
-	static Move jMove = {0};
-	static int warning = 0;
+	/* Pressed inputs, buttons still in EINT mode read as released */
+	raw = (uint8_t)((~p1 & JOYSTICK_PINS) >> 25) | (uint8_t)((((~p2 & BUTTON_PINS) >> 10) << INPUT_INT0) & inputGpio);
 	
-	/* Current move management*/
-	if(next==1){
-		//Next turn -> reset jmove
-		jMove.word32=0;
-		jMove.bits.playerID=activePlayer;
-		jMove.bits.x=player[activePlayer].x;
-		jMove.bits.y=player[activePlayer].y;
-		next=0;
-	}
+#ifdef SIMULATOR
+	ritWakeups++;
+	if((raw | inputState | cnt0) == 0) ritIdle++;
+#endif
 	
-	/* Joystick management */
-	if((LPC_GPIO1->FIOPIN & (1<<25)) == 0){	
-		/* Joytick J_Select pressed p1.25*/
-		J_select++;
-		if(J_select==1 && gameOn==1){
-				//Remove warning if present
-			  if(warning==1) {
-					drawMessageBox("   NO WALLS! Move token.", Sand); 
-					warning=0;
-				}
-				
-				//If inserting wall check acceptable wall position and trap
-				if(jMove.bits.move==1 && 
-  					(checkWallPosition(jMove.bits.x, jMove.bits.y, jMove.bits.orientation)==false ||
-						 checkTrap(jMove.bits.x, jMove.bits.y, jMove.bits.orientation)==false)){
-					return;
-				}
-		
-				executeMove(jMove, true);
-		}
-	}
-	else{J_select=0;}
-	
-	if((LPC_GPIO1->FIOPIN & (1<<26)) == 0){	
-		/* Joytick J_Down pressed p1.26 */
-		J_down++;
-		if(J_down==1 && gameOn==1){
-				//Remove warning if present
-			  if(warning==1) {
-					drawMessageBox("   NO WALLS! Move token.", Sand); 
-					warning=0;
-				}
-				
-				//Handle
-				if(jMove.bits.move==0 &&
-					player[activePlayer].x==jMove.bits.x &&
-					player[activePlayer].y==jMove.bits.y &&
-					player[activePlayer].direction.bits.down>0){
-					jMove.bits.x += player[activePlayer].direction.bits.down;
-					executeMove(jMove, false);
-				}
-				else if(jMove.bits.move==0 &&
-					(jMove.bits.x + player[activePlayer].direction.bits.down == player[activePlayer].x ||
-					 jMove.bits.x + player[activePlayer].direction.bits.up == player[activePlayer].x)&&
-					jMove.bits.y == player[activePlayer].y ){
-					jMove.bits.x = player[activePlayer].x;
-					jMove.bits.y = player[activePlayer].y;
-					executeMove(jMove, false);
-				}
-			 else if(jMove.bits.move==1 && jMove.bits.x+1<7){
-			    jMove.bits.x++;
-					executeMove(jMove, false);
-				}
-		}
-	}
-	else{J_down=0;}
+	/* A press toggles on its first sample. A release sets its count on the first
+	   sample and toggles on the 2nd consecutive one; any other sample clears it */
+	delta = raw ^ inputState;
+	toggle = (delta & raw) | (delta & cnt0);
+	cnt0 = delta & ~raw & ~cnt0;
+	inputState ^= toggle;
 	
-	if((LPC_GPIO1->FIOPIN & (1<<27)) == 0){	
-		/* Joytick J_Left pressed p1.27 */
-		J_left++;
-		if(J_left==1 && gameOn==1){
-				//Remove warning if present
-			  if(warning==1) {
-					drawMessageBox("   NO WALLS! Move token.", Sand); 
-					warning=0;
-				}
-			
-				//Handle
-				if(jMove.bits.move==0 &&
-					player[activePlayer].x==jMove.bits.x &&
-					player[activePlayer].y==jMove.bits.y &&
-					player[activePlayer].direction.bits.left>0){
-					jMove.bits.y -= player[activePlayer].direction.bits.left;
-					executeMove(jMove, false);
-				}
-				else if(jMove.bits.move==0 &&
-					jMove.bits.x == player[activePlayer].x &&
-				 (jMove.bits.y - player[activePlayer].direction.bits.left == player[activePlayer].y ||
-					jMove.bits.y - player[activePlayer].direction.bits.right == player[activePlayer].y)){
-					jMove.bits.x = player[activePlayer].x;
-					jMove.bits.y = player[activePlayer].y;
-					executeMove(jMove, false);
-				}
-				else if(jMove.bits.move==1 && jMove.bits.y-1>0){
-					jMove.bits.y--;
-					executeMove(jMove, false);
-				}
-		}
-	}
-	else{J_left=0;}
+	/* Buttons released (or a glitch that never settled): back to EINT */
+	rearm = inputGpio & ~(inputState | raw | cnt0);
+	inputGpio &= ~rearm;
 	
-	if((LPC_GPIO1->FIOPIN & (1<<28)) == 0){	
-		/* Joytick J_Right pressed p1.28 */
-		J_right++;
-		if(J_right==1 && gameOn==1){
-				//Remove warning if present
-			  if(warning==1) {
-					drawMessageBox("   NO WALLS! Move token.", Sand); 
-					warning=0;
-				}
-			
-				//Handle
-				if(jMove.bits.move==0 &&
-					player[activePlayer].x==jMove.bits.x &&
-					player[activePlayer].y==jMove.bits.y &&
-					player[activePlayer].direction.bits.right>0){
-					jMove.bits.y += player[activePlayer].direction.bits.right;
-					executeMove(jMove, false);
-				}
-				else if(jMove.bits.move==0 &&
-					(jMove.bits.y + player[activePlayer].direction.bits.right == player[activePlayer].y ||
-				  jMove.bits.y + player[activePlayer].direction.bits.left == player[activePlayer].y) &&
-					jMove.bits.x == player[activePlayer].x ){
-					jMove.bits.x = player[activePlayer].x;
-					jMove.bits.y = player[activePlayer].y;
-					executeMove(jMove, false);
-				}
-				else if(jMove.bits.move==1 && jMove.bits.y+1<7){
-					jMove.bits.y++;
-					executeMove(jMove, false);
-				}
-		}
-	}
-	else{J_right=0;}
-	
-	if((LPC_GPIO1->FIOPIN & (1<<29)) == 0){	
-		/* Joytick J_up pressed p1.29 */
-		J_up++;
-		if(J_up==1 && gameOn==1){
-				//Remove warning if present
-			  if(warning==1) {
-					drawMessageBox("   NO WALLS! Move token.", Sand); 
-					warning=0;
-				}
-				//Player mode with player in starting position
-				if(jMove.bits.move==0 &&
-					player[activePlayer].x==jMove.bits.x &&
-					player[activePlayer].y==jMove.bits.y &&
-					player[activePlayer].direction.bits.up>0){
-					jMove.bits.x -= player[activePlayer].direction.bits.up;
-					executeMove(jMove, false);
-				}
-				else if(jMove.bits.move==0 &&
-				 (jMove.bits.x - player[activePlayer].direction.bits.up == player[activePlayer].x ||
-					jMove.bits.x - player[activePlayer].direction.bits.down == player[activePlayer].x) &&
-					jMove.bits.y == player[activePlayer].y ){
-					jMove.bits.x = player[activePlayer].x;
-					jMove.bits.y = player[activePlayer].y;
-					executeMove(jMove, false);
-				}
-				else if(jMove.bits.move==1 && jMove.bits.x-1>0){
-					jMove.bits.x--;
-					executeMove(jMove, false);
-				}
-		}
-	}
-	else{J_up=0;}
-	
-	/* button management */
-	if(down_I0!=0){ 
-		down_I0++;	
-		if((LPC_GPIO2->FIOPIN & (1<<10)) == 0){    	/* INT0 pressed */	
-			if(down_I0==2 && gameOn<1){startGame();}
-		}
-		else {	/* button released */
-			down_I0=0;	
-			NVIC_EnableIRQ(EINT0_IRQn);							 /* enable Button interrupts			*/
-			LPC_PINCON->PINSEL4    |= (1 << 20);     /* External interrupt 0 pin selection */
-		}
-	}
-	
-	if(down_K1!=0){ 
-		down_K1++;
-		if((LPC_GPIO2->FIOPIN & (1<<11)) == 0){	/* KEY1 pressed */			
-			if(down_K1==2 && gameOn==1){
-				//HANDLE KEY1  -- Wall Placement
-				//Check wall availability
-				if(player[activePlayer].walls==0 && jMove.bits.move==0) {
-					warning = 1;
-					drawMessageBox("   NO WALLS! Move token.", Magenta);  } 
-				else if ( jMove.bits.move==0){
-					//Place central wall
-					jMove.bits.move=1;
-					jMove.bits.orientation=1;
-					jMove.bits.y=4;
-					jMove.bits.x=3;
-					executeMove(jMove, false);}
-				else if( jMove.bits.move==1) {
-					//Exit wall placement mode
-					jMove.bits.move=0;
-					jMove.bits.orientation=0;
-					jMove.bits.x=player[activePlayer].x;
-					jMove.bits.y=player[activePlayer].y;
-					executeMove(jMove, false);}	
+	for(i = 0; i < 8; i++){
+		bit = 1 << i;
+		if(toggle & bit){
+			if(inputState & bit){
+				if(inputAction[i].events & ON_PRESS) {
+					event_put(EVENT_PRESS, i);
+					BUTTON_LATENCY(i);
+				}
+				repeat[i] = inputAction[i].delay;
 			}
-		}
-		else {	/* button released */
-			down_K1=0;	
-			NVIC_EnableIRQ(EINT1_IRQn);							
-			LPC_PINCON->PINSEL4    |= (1 << 22);   
-		}
-	}
-	if(down_K2!=0){ 
-		down_K2++;
-		if((LPC_GPIO2->FIOPIN & (1<<12)) == 0){	/* KEY2 pressed */
-						
-			if(down_K2==2 && gameOn==1 && player[activePlayer].walls!=0){
-				//HANDLE KEY2 -- Wall rotation
-				if(jMove.bits.move==1){
-					jMove.bits.orientation=!jMove.bits.orientation;
-					executeMove(jMove, false);
-				}
+			else if(inputAction[i].events & ON_RELEASE){
+				event_put(EVENT_RELEASE, i);
 			}
 		}
-		else {	/* button released */
-			down_K2=0;	
-			NVIC_EnableIRQ(EINT2_IRQn);							
-			LPC_PINCON->PINSEL4    |= (1 << 24);    
+		else if((inputState & bit) && repeat[i] != 0 && --repeat[i] == 0){
+			event_put(EVENT_REPEAT, i);
+			repeat[i] = inputAction[i].rate;
+		}
+		if(rearm & bit){
+			NVIC_EnableIRQ((IRQn_Type)(EINT0_IRQn + inputAction[i].eint));	/* enable Button interrupts			*/
+			LPC_PINCON->PINSEL4 |= (1 << (20 + 2 * inputAction[i].eint));			/* External interrupt pin selection */
 		}
 	}
 	
+	/* Nothing to debounce or sample: stop until the next edge */
+	if(ritJoystick==0 && (inputState | cnt0 | inputGpio) == 0) disable_RIT();
+	
 	reset_RIT();
   LPC_RIT->RICTRL |= 0x1;	/* clear interrupt flag */
   return;
 }
 
+/******************************************************************************
+** Function name:		RIT_report
+**
+** Descriptions:		Stampa (simulatore) le interruzioni del RIT, quelle a vuoto e la latenza 
+**									dei pulsanti, dal fronte EINT all'evento EVENT_PRESS.
+**
+** parameters:			None
+** Returned value:		None
+**
+******************************************************************************/
+void RIT_report(void){
+#ifdef SIMULATOR
+	printf("RIT: %u wakeups, %u idle\n", ritWakeups, ritIdle);
+	if(latCount > 0) {
+		printf("button latency [us]: %u presses, min %u, avg %u, max %u\n", latCount, latMin, latSum / latCount, latMax);
+	}
+#endif
+}
+
 /******************************************************************************
 **                            End Of File
 ******************************************************************************/
@@ -10,13 +10,24 @@
 #ifndef __RIT_H
 #define __RIT_H
 
+/* The RIT runs only while needed: button debounce after an EINT edge, joystick
+   sampling while a game is on (poll_joystick) */
+#define RIT_TICK_MS        50    /* RIT interval set by main, one debounce sample */
+#define RIT_WAKE_MS        10    /* longest wait of the first sample after an edge */
+
 /* init_RIT.c */
+extern volatile uint8_t ritJoystick;
 extern uint32_t init_RIT( uint32_t RITInterval );
 extern void enable_RIT( void );
 extern void disable_RIT( void );
 extern void reset_RIT( void );
+extern void wake_RIT( void );
+extern void poll_joystick( uint8_t on );
+extern void rescale_RIT( uint32_t mul, uint32_t div );
 /* IRQ_RIT.c */
+extern volatile uint8_t inputGpio;
 extern void RIT_IRQHandler (void);
+extern void RIT_report( void );
 
 #endif /* end __RIT_H */
 /*****************************************************************************
@@ -9,6 +9,12 @@
 *********************************************************************************************************/
 #include "lpc17xx.h"
 #include "RIT.h"
+#include "../timer/timer.h"
+
+/* Joystick sampling requested by the game (P1 has no GPIO interrupts) */
+volatile uint8_t ritJoystick = 0;
+
+static RescaleCarry ritCarry = { 0, 1 };
 
 /******************************************************************************
 ** Function name:		enable_RIT
@@ -55,6 +61,73 @@ void reset_RIT( void )
   return;
 }
 
+/******************************************************************************
+** Function name:		wake_RIT
+**
+** Descriptions:		Input edge: starts the RIT if it was stopped and brings the next
+**									sample forward, so that it comes at most RIT_WAKE_MS later
+**									(the contacts have settled) instead of up to one interval.
+**
+** parameters:			None
+** Returned value:		None
+**
+******************************************************************************/
+void wake_RIT( void )
+{
+	uint32_t start = LPC_RIT->RICOMPVAL - LPC_RIT->RICOMPVAL / RIT_TICK_MS * RIT_WAKE_MS;
+
+	if( (LPC_RIT->RICTRL & (1<<3)) == 0 || LPC_RIT->RICOUNTER < start )
+	{
+		LPC_RIT->RICOUNTER = start;
+		enable_RIT();
+	}
+  return;
+}
+
+/******************************************************************************
+** Function name:		poll_joystick
+**
+** Descriptions:		Starts or stops the joystick sampling. When stopped, the RIT
+**									stops itself as soon as no button is being debounced.
+**
+** parameters:			on: 1 sample the joystick every RIT interval, 0 stop
+** Returned value:		None
+**
+******************************************************************************/
+void poll_joystick( uint8_t on )
+{
+	ritJoystick = on;
+	if( on )
+	{
+		wake_RIT();
+	}
+  return;
+}
+
+/******************************************************************************
+** Function name:		rescale_RIT
+**
+** Descriptions:		The core clock (RIT clock) changed by mul/div, interrupts masked:
+**									scales compare value and counter so that the interval is kept;
+**									the fraction of a tick truncated from the counter is carried
+**									to the next switch (rescale_count). RITINT is write-one-to-clear
+**									and is never written back.
+**
+** parameters:			mul, div: new/old core clock, reduced
+** Returned value:		None
+**
+******************************************************************************/
+void rescale_RIT( uint32_t mul, uint32_t div )
+{
+	uint32_t ctrl = LPC_RIT->RICTRL & ~(1<<0);
+
+	LPC_RIT->RICTRL = ctrl & ~(1<<3);
+	LPC_RIT->RICOMPVAL = LPC_RIT->RICOMPVAL * mul / div;
+	LPC_RIT->RICOUNTER = rescale_count(LPC_RIT->RICOUNTER, mul, div, &ritCarry);
+	LPC_RIT->RICTRL = ctrl;
+  return;
+}
+
 uint32_t init_RIT ( uint32_t RITInterval )
 {
   
@@ -0,0 +1,73 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           boardtables.c
+** Descriptions:        GENERATED by tools/boardtables.py, do not edit. Neighbours, jump squares,
+**                      border and wall sides of the 49 squares of the board
+** Correlated files:    boardtables.h, quoridor.c
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#include "boardtables.h"
+
+const uint8_t squareRow[BOARD_SQUARES] = {
+	0, 0, 0, 0, 0, 0, 0,
+	1, 1, 1, 1, 1, 1, 1,
+	2, 2, 2, 2, 2, 2, 2,
+	3, 3, 3, 3, 3, 3, 3,
+	4, 4, 4, 4, 4, 4, 4,
+	5, 5, 5, 5, 5, 5, 5,
+	6, 6, 6, 6, 6, 6, 6
+};
+
+const uint8_t squareColumn[BOARD_SQUARES] = {
+	0, 1, 2, 3, 4, 5, 6,
+	0, 1, 2, 3, 4, 5, 6,
+	0, 1, 2, 3, 4, 5, 6,
+	0, 1, 2, 3, 4, 5, 6,
+	0, 1, 2, 3, 4, 5, 6,
+	0, 1, 2, 3, 4, 5, 6,
+	0, 1, 2, 3, 4, 5, 6
+};
+
+const uint8_t squareStep[BOARD_SQUARES][STEPS] = {
+	{255,  7,255,  1}, {255,  8,  0,  2}, {255,  9,  1,  3}, {255, 10,  2,  4}, {255, 11,  3,  5}, {255, 12,  4,  6}, {255, 13,  5,255},
+	{  0, 14,255,  8}, {  1, 15,  7,  9}, {  2, 16,  8, 10}, {  3, 17,  9, 11}, {  4, 18, 10, 12}, {  5, 19, 11, 13}, {  6, 20, 12,255},
+	{  7, 21,255, 15}, {  8, 22, 14, 16}, {  9, 23, 15, 17}, { 10, 24, 16, 18}, { 11, 25, 17, 19}, { 12, 26, 18, 20}, { 13, 27, 19,255},
+	{ 14, 28,255, 22}, { 15, 29, 21, 23}, { 16, 30, 22, 24}, { 17, 31, 23, 25}, { 18, 32, 24, 26}, { 19, 33, 25, 27}, { 20, 34, 26,255},
+	{ 21, 35,255, 29}, { 22, 36, 28, 30}, { 23, 37, 29, 31}, { 24, 38, 30, 32}, { 25, 39, 31, 33}, { 26, 40, 32, 34}, { 27, 41, 33,255},
+	{ 28, 42,255, 36}, { 29, 43, 35, 37}, { 30, 44, 36, 38}, { 31, 45, 37, 39}, { 32, 46, 38, 40}, { 33, 47, 39, 41}, { 34, 48, 40,255},
+	{ 35,255,255, 43}, { 36,255, 42, 44}, { 37,255, 43, 45}, { 38,255, 44, 46}, { 39,255, 45, 47}, { 40,255, 46, 48}, { 41,255, 47,255}
+};
+
+const uint8_t squareJump[BOARD_SQUARES][STEPS] = {
+	{255, 14,255,  2}, {255, 15,255,  3}, {255, 16,  0,  4}, {255, 17,  1,  5}, {255, 18,  2,  6}, {255, 19,  3,255}, {255, 20,  4,255},
+	{255, 21,255,  9}, {255, 22,255, 10}, {255, 23,  7, 11}, {255, 24,  8, 12}, {255, 25,  9, 13}, {255, 26, 10,255}, {255, 27, 11,255},
+	{  0, 28,255, 16}, {  1, 29,255, 17}, {  2, 30, 14, 18}, {  3, 31, 15, 19}, {  4, 32, 16, 20}, {  5, 33, 17,255}, {  6, 34, 18,255},
+	{  7, 35,255, 23}, {  8, 36,255, 24}, {  9, 37, 21, 25}, { 10, 38, 22, 26}, { 11, 39, 23, 27}, { 12, 40, 24,255}, { 13, 41, 25,255},
+	{ 14, 42,255, 30}, { 15, 43,255, 31}, { 16, 44, 28, 32}, { 17, 45, 29, 33}, { 18, 46, 30, 34}, { 19, 47, 31,255}, { 20, 48, 32,255},
+	{ 21,255,255, 37}, { 22,255,255, 38}, { 23,255, 35, 39}, { 24,255, 36, 40}, { 25,255, 37, 41}, { 26,255, 38,255}, { 27,255, 39,255},
+	{ 28,255,255, 44}, { 29,255,255, 45}, { 30,255, 42, 46}, { 31,255, 43, 47}, { 32,255, 44, 48}, { 33,255, 45,255}, { 34,255, 46,255}
+};
+
+const uint8_t squareBorder[BOARD_SQUARES] = {
+	0x5, 0x1, 0x1, 0x1, 0x1, 0x1, 0x9,
+	0x4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+	0x4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+	0x4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+	0x4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+	0x4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+	0x6, 0x2, 0x2, 0x2, 0x2, 0x2, 0xA
+};
+
+const int8_t wallEdgeSquare[2][4] = {
+	{0, -7, -1, -8},
+	{0, -1, -7, -8}
+};
+
+const uint8_t wallEdgeStep[2][4] = {
+	{STEP_LEFT, STEP_LEFT, STEP_RIGHT, STEP_RIGHT},
+	{STEP_UP, STEP_UP, STEP_DOWN, STEP_DOWN}
+};
+
+/******************************************************************************
+**                            End Of File
+******************************************************************************/
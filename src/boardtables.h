@@ -0,0 +1,39 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           boardtables.h
+** Descriptions:        GENERATED by tools/boardtables.py, do not edit. Neighbours, jump squares,
+**                      border and wall sides of the 49 squares of the board
+** Correlated files:    boardtables.c, quoridor.c
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#ifndef __BOARDTABLES_H
+#define __BOARDTABLES_H
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Private define ------------------------------------------------------------*/
+#define BOARD_SQUARES   49
+#define SQUARE(x, y)    ((x) * 7 + (y))
+#define NO_SQUARE       0xFF
+
+#define STEP_UP         0
+#define STEP_DOWN       1
+#define STEP_LEFT       2
+#define STEP_RIGHT      3
+#define STEPS           4
+#define STEP_BIT(step)  (1 << (step))
+
+/* Private variables ---------------------------------------------------------*/
+extern const uint8_t squareRow[BOARD_SQUARES];
+extern const uint8_t squareColumn[BOARD_SQUARES];
+extern const uint8_t squareStep[BOARD_SQUARES][STEPS];     /* NO_SQUARE: off the board */
+extern const uint8_t squareJump[BOARD_SQUARES][STEPS];     /* NO_SQUARE: off the board */
+extern const uint8_t squareBorder[BOARD_SQUARES];          /* STEP_BIT of the steps off the board */
+extern const int8_t wallEdgeSquare[2][4];                  /* by orientation, from the wall square */
+extern const uint8_t wallEdgeStep[2][4];
+
+#endif /* end __BOARDTABLES_H */
+/*****************************************************************************
+**                            End Of File
+******************************************************************************/
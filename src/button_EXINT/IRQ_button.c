@@ -1,14 +1,21 @@
 #include "button.h"
 #include "lpc17xx.h"
 #include "../RIT/RIT.h"		 
+#include "../timer/timer.h"
+#include "../event/event.h"
 
-extern int down_I0;
-extern int down_K1;
-extern int down_K2;
+#ifdef SIMULATOR
+extern volatile uint32_t buttonEdge[3];          /* input latency, see RIT_report */
+#define BUTTON_EDGE(b)  (buttonEdge[b] = read_timebase())
+#else
+#define BUTTON_EDGE(b)
+#endif
 
 void EINT0_IRQHandler (void)	  	/* INT0														 */
 {		
-	down_I0=1;
+	inputGpio |= (1 << INPUT_INT0);           /* debounced by the RIT from FIOPIN2 */
+	BUTTON_EDGE(0);
+	wake_RIT();
 	NVIC_DisableIRQ(EINT0_IRQn);	         	/* disable Button interrupts			 */
 	LPC_PINCON->PINSEL4    &= ~(1 << 20);     /* GPIO pin selection */
 	
@@ -18,7 +25,9 @@ void EINT0_IRQHandler (void)	  	/* INT0														 */
 
 void EINT1_IRQHandler (void)	  	/* KEY1														 */
 {
-	down_K1=1;
+	inputGpio |= (1 << INPUT_KEY1);
+	BUTTON_EDGE(1);
+	wake_RIT();
 	NVIC_DisableIRQ(EINT1_IRQn);		/* disable Button interrupts			 */
 	LPC_PINCON->PINSEL4    &= ~(1 << 22);     /* GPIO pin selection */
 	
@@ -27,7 +36,9 @@ void EINT1_IRQHandler (void)	  	/* KEY1														 */
 
 void EINT2_IRQHandler (void)	  	/* KEY2														 */
 {	
-	down_K2=1;
+	inputGpio |= (1 << INPUT_KEY2);
+	BUTTON_EDGE(2);
+	wake_RIT();
 	NVIC_DisableIRQ(EINT2_IRQn);		          /* disable Button interrupts			 */
 	LPC_PINCON->PINSEL4    &= ~(1 << 24);     /* GPIO pin selection */
 
@@ -0,0 +1,35 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           clock.h
+** Last modified Date:  2026-10-19
+** Last Version:        V1.00
+** Descriptions:        Core clock governor: CCLK divider of PLL0 switched between a low idle speed
+**                      and full speed, timers rescaled so that their periods are unchanged
+** Correlated files:    lib_clock.c, lib_timer.c, lib_RIT.c, lib_sched.c, GLCD.c
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#ifndef __CLOCK_H
+#define __CLOCK_H
+
+#include <stdint.h>
+
+/* Levels */
+#define CLOCK_FULL          0     /* CCLKCFG set by SystemInit (100 MHz)      */
+#define CLOCK_IDLE          1     /* CLOCK_IDLE_CCLKSEL                       */
+#define CLOCK_LEVELS        2
+
+/* PLL0 divider of the idle level: 400 MHz / 20 = 20 MHz. It must be odd (PLL0
+   connected) and give a CCLK multiple of 4 MHz, so that TIMER0/TIMER1 (CCLK/4)
+   still run at a whole number of MHz and their periods scale exactly */
+#define CLOCK_IDLE_CCLKSEL  19
+
+/* lib_clock.c */
+extern uint8_t clockLevel;
+extern void clock_init( void );
+extern void clock_set( uint8_t level );
+extern void clock_report( void );
+
+#endif /* end __CLOCK_H */
+/*****************************************************************************
+**                            End Of File
+******************************************************************************/
@@ -0,0 +1,155 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           lib_clock.c
+** Last modified Date:  2026-10-19
+** Last Version:        V1.00
+** Descriptions:        Core clock governor: PLL0 stays locked and connected, only the CCLK divider
+**                      changes; TIMER0, the RIT, the TIMER1 timebase and the LCD bus waits follow
+** Correlated files:    clock.h, lib_timer.c, lib_RIT.c, lib_sched.c, GLCD.c
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#include "lpc17xx.h"
+#include "clock.h"
+#include "../timer/timer.h"
+#include "../RIT/RIT.h"
+#include "../GLCD/GLCD.h"
+#include <stdio.h>
+
+extern uint32_t SystemFrequency;			/* core clock, system_LPC17xx.c */
+
+uint8_t clockLevel = CLOCK_FULL;
+
+static uint32_t fcco;                       /* PLL0 output, Hz                  */
+static uint8_t cclksel[CLOCK_LEVELS];       /* CCLKCFG of each level            */
+static uint32_t switches[CLOCK_LEVELS];     /* switches to each level           */
+static uint32_t timeAt[CLOCK_LEVELS];       /* us spent at each level           */
+static uint32_t since;                      /* timebase at the last switch      */
+
+#ifdef SIMULATOR
+/* Register model check: after each switch the TIMER0 and RIT periods and the
+   timebase tick must be exactly those programmed at full speed */
+static uint32_t timer0Us, ritUs;
+volatile uint32_t clockPeriodErrors = 0;
+
+/* PCLK of a timer in MHz, from its PCLKSEL0 field (bit offset) */
+static uint32_t pclkMHz( uint8_t shift ){
+	static const uint8_t pclkDiv[4] = { 4, 1, 2, 8 };
+	return SystemFrequency / 1000000 / pclkDiv[(LPC_SC->PCLKSEL0 >> shift) & 0x03];
+}
+
+static void verifyPeriods( void ){
+	if( LPC_TIM0->MR0 != timer0Us * pclkMHz(2) ) clockPeriodErrors++;
+	if( LPC_RIT->RICOMPVAL != ritUs * (SystemFrequency / 1000000) ) clockPeriodErrors++;
+	if( LPC_TIM1->PR + 1 != pclkMHz(4) ) clockPeriodErrors++;
+}
+#define CLOCK_VERIFY()  verifyPeriods()
+#else
+#define CLOCK_VERIFY()
+#endif
+
+/******************************************************************************
+** Function name:		clock_init
+**
+** Descriptions:		Takes the clock set by SystemInit as the full speed level.
+**									Called once TIMER0, the RIT and the timebase are programmed.
+**
+** parameters:			None
+** Returned value:		None
+**
+******************************************************************************/
+void clock_init( void )
+{
+	cclksel[CLOCK_FULL] = LPC_SC->CCLKCFG & 0xFF;
+	cclksel[CLOCK_IDLE] = CLOCK_IDLE_CCLKSEL;
+	fcco = SystemFrequency * (cclksel[CLOCK_FULL] + 1);
+	clockLevel = CLOCK_FULL;
+	since = read_timebase();
+#ifdef SIMULATOR
+	timer0Us = LPC_TIM0->MR0 / pclkMHz(2);
+	ritUs = LPC_RIT->RICOMPVAL / (SystemFrequency / 1000000);
+#endif
+  return;
+}
+
+/******************************************************************************
+** Function name:		clock_set
+**
+** Descriptions:		Switches the core clock to a level. With the interrupts masked
+**									the CCLK divider is changed and the match values and counts of
+**									TIMER0 and the RIT are scaled by new/old clock, so the periods
+**									(turn seconds, debounce ticks) are unchanged; the counts are
+**									truncated to the new clock, the fraction being carried to the
+**									next switch (rescale_count). The timebase prescaler is
+**									recomputed. The LCD bus waits follow (LCD_BusTiming).
+**
+** parameters:			level: CLOCK_*
+** Returned value:		None
+**
+******************************************************************************/
+void clock_set( uint8_t level )
+{
+	uint32_t from, to, a, b, r, now;
+
+	if( level == clockLevel )
+	{
+		return;
+	}
+	from = SystemFrequency / 1000000;
+	to = fcco / (cclksel[level] + 1) / 1000000;
+	/* reduce to/from, so that the scaled registers cannot overflow */
+	a = from;
+	b = to;
+	while( b != 0 )
+	{
+		r = a % b;
+		a = b;
+		b = r;
+	}
+
+	__disable_irq();
+	now = read_timebase();
+	timeAt[clockLevel] += now - since;
+	since = now;
+	LPC_SC->CCLKCFG = cclksel[level];
+	SystemFrequency = fcco / (cclksel[level] + 1);
+	rescale_timers(to / a, from / a);
+	rescale_RIT(to / a, from / a);
+	clockLevel = level;
+	switches[level]++;
+	__enable_irq();
+
+	LCD_BusTiming();
+	CLOCK_VERIFY();
+  return;
+}
+
+/******************************************************************************
+** Function name:		clock_report
+**
+** Descriptions:		Prints the switches and the time spent at each level (Debug
+**									(printf) Viewer)
+**
+** parameters:			None
+** Returned value:		None
+**
+******************************************************************************/
+void clock_report( void )
+{
+	uint32_t now = read_timebase();
+	uint8_t i;
+
+	timeAt[clockLevel] += now - since;
+	since = now;
+	for( i = 0; i < CLOCK_LEVELS; i++ )
+	{
+		printf("clock %3u MHz: %u switches, %u ms\n", fcco / (cclksel[i] + 1) / 1000000, switches[i], timeAt[i] / 1000);
+	}
+#ifdef SIMULATOR
+	printf("clock: %u timer period errors\n", clockPeriodErrors);
+#endif
+  return;
+}
+
+/******************************************************************************
+**                            End Of File
+******************************************************************************/
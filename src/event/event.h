@@ -0,0 +1,51 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           event.h
+** Last modified Date:  2026-10-19
+** Last Version:        V1.00
+** Descriptions:        Event queue between the interrupt handlers and the main loop: the ISRs only
+**                      push compact events, the game runs in main
+** Correlated files:    lib_event.c, IRQ_RIT.c, IRQ_timer.c, quoridor.c, sample.c
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#ifndef __EVENT_H
+#define __EVENT_H
+
+#include <stdint.h>
+
+/* Queue length, power of two. The producers (RIT, TIMER0) run at the same interrupt
+   priority and never preempt each other: towards main they act as a single producer */
+#define EVENT_QUEUE_SIZE    16
+
+/* Event types */
+#define EVENT_PRESS         1     /* debounced press, arg: INPUT_*               */
+#define EVENT_TICK          2     /* TIMER0 match, one second of the turn elapsed */
+#define EVENT_RELEASE       3     /* debounced release, arg: INPUT_*             */
+#define EVENT_REPEAT        4     /* input held, auto-repeat, arg: INPUT_*       */
+
+/* Inputs */
+#define INPUT_SELECT        0     /* joystick P1.25 */
+#define INPUT_DOWN          1     /* joystick P1.26 */
+#define INPUT_LEFT          2     /* joystick P1.27 */
+#define INPUT_RIGHT         3     /* joystick P1.28 */
+#define INPUT_UP            4     /* joystick P1.29 */
+#define INPUT_INT0          5     /* button P2.10   */
+#define INPUT_KEY1          6     /* button P2.11   */
+#define INPUT_KEY2          7     /* button P2.12   */
+
+typedef struct{
+	uint8_t type;
+	uint8_t arg;
+	uint32_t time;                 /* timebase when queued (latency probe) */
+}Event;
+
+/* lib_event.c */
+extern volatile uint32_t eventDropped;
+extern uint8_t event_put( uint8_t type, uint8_t arg );
+extern uint8_t event_get( Event *e );
+extern uint8_t event_pending( void );
+
+#endif /* end __EVENT_H */
+/*****************************************************************************
+**                            End Of File
+******************************************************************************/
@@ -0,0 +1,87 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           lib_event.c
+** Last modified Date:  2026-10-19
+** Last Version:        V1.00
+** Descriptions:        Single-producer/single-consumer event ring, lock-free: the producer only
+**                      writes head, the consumer only writes tail
+** Correlated files:    event.h
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#include "event.h"
+#include "../timer/timer.h"
+
+volatile uint32_t eventDropped = 0;
+
+static volatile Event queue[EVENT_QUEUE_SIZE];
+static volatile uint8_t head = 0;         /* next slot written, ISR side */
+static volatile uint8_t tail = 0;         /* next slot read, main side   */
+
+/******************************************************************************
+** Function name:		event_put
+**
+** Descriptions:		Appends an event stamped with the timebase (interrupt handlers
+**									only). The slot is filled before head is published, so main
+**									never reads a partial event.
+**
+** parameters:			type: EVENT_*, arg: event argument
+** Returned value:		1 if queued, 0 if the queue is full (counted in eventDropped)
+**
+******************************************************************************/
+uint8_t event_put( uint8_t type, uint8_t arg )
+{
+	uint8_t h = head;
+
+	if( (uint8_t)(h - tail) == EVENT_QUEUE_SIZE )
+	{
+		eventDropped++;
+		return 0;
+	}
+	queue[h & (EVENT_QUEUE_SIZE - 1)].type = type;
+	queue[h & (EVENT_QUEUE_SIZE - 1)].arg = arg;
+	queue[h & (EVENT_QUEUE_SIZE - 1)].time = read_timebase();
+	head = h + 1;
+	return 1;
+}
+
+/******************************************************************************
+** Function name:		event_get
+**
+** Descriptions:		Takes the oldest event (main loop only)
+**
+** parameters:			e: filled with the event
+** Returned value:		1 if an event was taken, 0 if the queue is empty
+**
+******************************************************************************/
+uint8_t event_get( Event *e )
+{
+	uint8_t t = tail;
+
+	if( t == head )
+	{
+		return 0;
+	}
+	e->type = queue[t & (EVENT_QUEUE_SIZE - 1)].type;
+	e->arg = queue[t & (EVENT_QUEUE_SIZE - 1)].arg;
+	e->time = queue[t & (EVENT_QUEUE_SIZE - 1)].time;
+	tail = t + 1;
+	return 1;
+}
+
+/******************************************************************************
+** Function name:		event_pending
+**
+** Descriptions:		Tells whether events are waiting
+**
+** parameters:			None
+** Returned value:		1 if the queue is not empty
+**
+******************************************************************************/
+uint8_t event_pending( void )
+{
+	return head != tail;
+}
+
+/******************************************************************************
+**                            End Of File
+******************************************************************************/
@@ -0,0 +1,47 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           latency.h
+** Last modified Date:  2026-10-19
+** Last Version:        V1.00
+** Descriptions:        Input-to-pixel latency probe: from the debounced input queued by the RIT to the
+**                      last GRAM write of the redraw it triggers, one histogram per input type
+** Correlated files:    lib_latency.c, event.h, quoridor.c, sample.c
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#ifndef __LATENCY_H
+#define __LATENCY_H
+
+#include <stdint.h>
+
+/* Measured input types */
+#define LATENCY_STEP        0     /* joystick direction: token step or wall shift */
+#define LATENCY_ROTATE      1     /* KEY2: wall rotation                          */
+#define LATENCY_CONFIRM     2     /* SELECT: move confirmed                       */
+#define LATENCY_TYPES       3
+
+/* Histogram: LATENCY_BUCKETS linear buckets, the last one collects everything above */
+#define LATENCY_BUCKET_US   250
+#define LATENCY_BUCKETS     64
+
+/*******************************************************************************
+**   Statistics of one input type, in microseconds of the TIMER1 timebase.
+********************************************************************************/
+typedef struct{
+	uint32_t count;
+	uint32_t min;
+	uint32_t max;
+	uint32_t sum;
+	uint16_t bucket[LATENCY_BUCKETS];
+}LatencyStats;
+
+/* lib_latency.c */
+extern LatencyStats latencyStats[LATENCY_TYPES];
+extern void latency_begin( uint8_t input, uint32_t time );
+extern void latency_end( void );
+extern void latency_cancel( void );
+extern void latency_report( void );
+
+#endif /* end __LATENCY_H */
+/*****************************************************************************
+**                            End Of File
+******************************************************************************/
@@ -0,0 +1,145 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           lib_latency.c
+** Last modified Date:  2026-10-19
+** Last Version:        V1.00
+** Descriptions:        Input-to-pixel latency probe: one measurement is open at a time, started by the
+**                      main loop when it takes an input event and closed after the last GRAM write
+** Correlated files:    latency.h, event.h, quoridor.c, sample.c
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#include "latency.h"
+#include "../timer/timer.h"
+#include <stdio.h>
+
+LatencyStats latencyStats[LATENCY_TYPES];
+
+/* Measured type of each input (INPUT_*), -1: not measured */
+static const int8_t inputType[8] = {
+	LATENCY_CONFIRM,                                                  /* SELECT */
+	LATENCY_STEP, LATENCY_STEP, LATENCY_STEP, LATENCY_STEP,           /* DOWN, LEFT, RIGHT, UP */
+	-1, -1,                                                           /* INT0, KEY1 */
+	LATENCY_ROTATE                                                    /* KEY2 */
+};
+
+static const char *typeName[LATENCY_TYPES] = { "step", "rotate", "confirm" };
+
+static int8_t openType = -1;      /* type of the open measurement, -1: none */
+static uint32_t openTime;         /* timebase when its event was queued     */
+
+/******************************************************************************
+** Function name:		latency_begin
+**
+** Descriptions:		Opens a measurement for an input event taken from the queue,
+**									replacing one left open by the previous event.
+**
+** parameters:			input: INPUT_*, time: timebase when the event was queued
+** Returned value:		None
+**
+******************************************************************************/
+void latency_begin( uint8_t input, uint32_t time )
+{
+	openType = inputType[input & 7];
+	openTime = time;
+  return;
+}
+
+/******************************************************************************
+** Function name:		latency_end
+**
+** Descriptions:		Closes the open measurement, if any: called after the last GRAM
+**									write of a redraw.
+**
+** parameters:			None
+** Returned value:		None
+**
+******************************************************************************/
+void latency_end( void )
+{
+	LatencyStats *s;
+	uint32_t d, b;
+
+	if( openType < 0 )
+	{
+		return;
+	}
+	s = &latencyStats[openType];
+	openType = -1;
+
+	d = read_timebase() - openTime;
+	b = d / LATENCY_BUCKET_US;
+	if( b >= LATENCY_BUCKETS ) b = LATENCY_BUCKETS - 1;
+	if( s->bucket[b] != 0xFFFF ) s->bucket[b]++;
+	if( s->count == 0 || d < s->min ) s->min = d;
+	s->count++;
+	s->sum += d;
+	if( d > s->max ) s->max = d;
+  return;
+}
+
+/******************************************************************************
+** Function name:		latency_cancel
+**
+** Descriptions:		Drops the open measurement: the input did not redraw anything.
+**
+** parameters:			None
+** Returned value:		None
+**
+******************************************************************************/
+void latency_cancel( void )
+{
+	openType = -1;
+  return;
+}
+
+/******************************************************************************
+** Function name:		latency_report
+**
+** Descriptions:		Prints min/avg/p99/max and the non-empty histogram buckets of
+**									each input type (Debug (printf) Viewer). p99 is the upper bound
+**									of the bucket holding the 99th percentile.
+**
+** parameters:			None
+** Returned value:		None
+**
+******************************************************************************/
+void latency_report( void )
+{
+	LatencyStats *s;
+	uint32_t rank, seen, p99;
+	uint8_t t, b;
+
+	printf("input-to-pixel latency [us]:\n");
+	for( t = 0; t < LATENCY_TYPES; t++ )
+	{
+		s = &latencyStats[t];
+		if( s->count == 0 )
+		{
+			continue;
+		}
+		rank = (s->count * 99 + 99) / 100;
+		seen = 0;
+		for( b = 0; b < LATENCY_BUCKETS - 1; b++ )
+		{
+			seen += s->bucket[b];
+			if( seen >= rank ) break;
+		}
+		p99 = (uint32_t)(b + 1) * LATENCY_BUCKET_US;
+		if( p99 > s->max ) p99 = s->max;
+		printf("%-8s %5u inputs, min %u, avg %u, p99 %u, max %u\n",
+		       typeName[t], s->count, s->min, s->sum / s->count, p99, s->max);
+		for( b = 0; b < LATENCY_BUCKETS; b++ )
+		{
+			if( s->bucket[b] != 0 )
+			{
+				printf("  %5u%s %5u\n", (uint32_t)b * LATENCY_BUCKET_US,
+				       b == LATENCY_BUCKETS - 1 ? "+" : " ", s->bucket[b]);
+			}
+		}
+	}
+  return;
+}
+
+/******************************************************************************
+**                            End Of File
+******************************************************************************/
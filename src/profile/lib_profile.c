@@ -0,0 +1,107 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           lib_profile.c
+** Last modified Date:  2026-10-19
+** Last Version:        V1.00
+** Descriptions:        Cycle profiling zones: counter set-up, per-zone accumulation and report
+** Correlated files:    profile.h, quoridor.c, GLCD.c
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#include "profile.h"
+#include <stdio.h>
+#include <string.h>
+
+ProfileZone profileZones[PROFILE_ZONES];
+
+/* Names of the zones, by PROFILE_* */
+static const char *zoneName[PROFILE_ZONES] = {
+	"executeMove", "checkTrap", "search", "drawWall", "drawCircle", "PutChar", "LCD_Clear"
+};
+
+/******************************************************************************
+** Function name:		profile_init
+**
+** Descriptions:		Starts the cycle counter: DWT CYCCNT on the board, SysTick free
+**									running on the core clock in the simulator (as the LCD timing
+**									check of GLCD.c), nothing when the build supplies its counter.
+**
+** parameters:			None
+** Returned value:		None
+**
+******************************************************************************/
+void profile_init(void)
+{
+#if defined(PROFILE_COUNTER)
+#elif defined(SIMULATOR)
+	SysTick->LOAD = 0xFFFFFF;                /* free running, core clock, no interrupt */
+	SysTick->VAL  = 0;
+	SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_ENABLE_Msk;
+#else
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+	profile_reset();
+}
+
+/******************************************************************************
+** Function name:		profile_add
+**
+** Descriptions:		Accumulates one outermost call of a zone (PROFILE_END)
+**
+** parameters:			zone: PROFILE_*, cycles: duration of the call
+** Returned value:		None
+**
+******************************************************************************/
+void profile_add(uint8_t zone, uint32_t cycles)
+{
+	ProfileZone *z = &profileZones[zone];
+
+	z->timed++;
+	z->cycles += cycles;
+	if( cycles > z->max ) z->max = cycles;
+}
+
+/******************************************************************************
+** Function name:		profile_reset
+**
+** Descriptions:		Clears the counters of every zone. Must not be called from
+**									inside a zone.
+**
+** parameters:			None
+** Returned value:		None
+**
+******************************************************************************/
+void profile_reset(void)
+{
+	memset(profileZones, 0, sizeof(profileZones));
+}
+
+/******************************************************************************
+** Function name:		profile_report
+**
+** Descriptions:		Prints the counters of the zones that ran (Debug (printf) Viewer)
+**
+** parameters:			None
+** Returned value:		None
+**
+******************************************************************************/
+void profile_report(void)
+{
+	uint8_t i;
+
+	printf("%-12s %8s %8s %12s %10s %10s\n", "zone", "calls", "timed", "cycles", "avg", "max");
+	for( i = 0; i < PROFILE_ZONES; i++ )
+	{
+		if( profileZones[i].timed == 0 )
+		{
+			continue;
+		}
+		printf("%-12s %8u %8u %12u %10u %10u\n", zoneName[i], profileZones[i].calls, profileZones[i].timed,
+		       profileZones[i].cycles, profileZones[i].cycles / profileZones[i].timed, profileZones[i].max);
+	}
+}
+
+/******************************************************************************
+**                            End Of File
+******************************************************************************/
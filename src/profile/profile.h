@@ -0,0 +1,84 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           profile.h
+** Last modified Date:  2026-10-19
+** Last Version:        V1.00
+** Descriptions:        Cycle profiling zones: calls, total and worst cycles of the hot functions,
+**                      from the DWT cycle counter (SysTick in the simulator)
+** Correlated files:    lib_profile.c, quoridor.c, GLCD.c
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#ifndef __PROFILE_H
+#define __PROFILE_H
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include "LPC17xx.h"
+
+/* Private define ------------------------------------------------------------*/
+
+/* Comment out to compile the zones out */
+#define PROFILE_ENABLE
+
+/* Zones */
+#define PROFILE_EXECUTE_MOVE    0
+#define PROFILE_CHECK_TRAP      1
+#define PROFILE_SEARCH          2
+#define PROFILE_DRAW_WALL       3
+#define PROFILE_DRAW_CIRCLE     4
+#define PROFILE_PUT_CHAR        5
+#define PROFILE_LCD_CLEAR       6
+#define PROFILE_ZONES           7
+
+/* Cycle counter, counting up. A build can supply its own PROFILE_COUNTER() (the
+   QEMU benchmark uses its instruction-counting timer); the Vision simulator
+   counts with SysTick, free running on the core clock (24 bits: zones up to
+   ~167 ms at 100 MHz); the board uses the DWT CYCCNT */
+#if defined(PROFILE_COUNTER)
+extern uint32_t PROFILE_COUNTER(void);
+#define PROFILE_NOW()           PROFILE_COUNTER()
+#define PROFILE_MASK            0xFFFFFFFF
+#elif defined(SIMULATOR)
+#define PROFILE_NOW()           (0u - SysTick->VAL)
+#define PROFILE_MASK            0xFFFFFF
+#else
+#define PROFILE_NOW()           (DWT->CYCCNT)
+#define PROFILE_MASK            0xFFFFFFFF
+#endif
+
+/* Private typedef -----------------------------------------------------------*/
+
+/*******************************************************************************
+**   Counters of one zone. A recursive zone (search) is timed from its outermost
+**   call only, every call is counted.
+********************************************************************************/
+typedef struct{
+	uint32_t calls;
+	uint32_t timed;       /* outermost calls              */
+	uint32_t cycles;      /* total of the outermost calls */
+	uint32_t max;         /* worst outermost call         */
+	uint32_t start;
+	uint8_t depth;
+}ProfileZone;
+
+/* Private variables ---------------------------------------------------------*/
+extern ProfileZone profileZones[PROFILE_ZONES];
+
+#ifdef PROFILE_ENABLE
+#define PROFILE_BEGIN(zone)  { profileZones[zone].calls++; if( profileZones[zone].depth++ == 0 ) profileZones[zone].start = PROFILE_NOW(); }
+#define PROFILE_END(zone)    { if( --profileZones[zone].depth == 0 ) profile_add(zone, (PROFILE_NOW() - profileZones[zone].start) & PROFILE_MASK); }
+#else
+#define PROFILE_BEGIN(zone)
+#define PROFILE_END(zone)
+#endif
+
+/* Private function prototypes -----------------------------------------------*/
+void profile_init(void);
+void profile_add(uint8_t zone, uint32_t cycles);
+void profile_reset(void);
+void profile_report(void);
+
+#endif /* end __PROFILE_H */
+/*****************************************************************************
+**                            End Of File
+******************************************************************************/
@@ -8,8 +8,15 @@
 **--------------------------------------------------------------------------------------------------------
 *********************************************************************************************************/
 #include "GLCD/GLCD.h"
+#include "GLCD/LCDCost.h"
+#include "GLCD/LCDList.h"
 #include "quoridor.h"
+#include "startscreen.h"
 #include "timer/timer.h"
+#include "RIT/RIT.h"
+#include "latency/latency.h"
+#include "profile/profile.h"
+#include "record/record.h"
 #include <string.h>
 
 #define BOARD_SIZE 7 
@@ -19,17 +26,47 @@
 #define RECTANGLE_HEIGHT 50
 #define MBOX_WIDTH 224
 #define MBOX_HEIGHT 25
+#define GAME_LOG_SIZE 512
+#define TOKEN_RADIUS ((SQUARE_SIZE - SPACE_BETWEEN) / 2 - 1)
 
-Player player[2];
-Box board[7][7];
-Wall wallsArray[16];
-uint8_t nWalls=0;
-Move lastMove;
-uint8_t activePlayer;
-volatile int gameOn=0;
-volatile int next=0;
-volatile int wallOk=0;
-extern int timeQuoridor;
+/* Neighbour, jump and border tables of the squares: tools/boardtables.py, rerun it after a change */
+#if BOARD_SQUARES != BOARD_SIZE * BOARD_SIZE
+#error "boardtables.c must be regenerated for the new BOARD_SIZE"
+#endif
+
+/* The game of the firmware: the only instance, used by handleEvent and the tasks */
+static Game game;
+
+/* Screen rectangle covered by wall previews and not yet restored (dirtyW == 0: none) */
+static uint16_t dirtyX, dirtyY, dirtyW = 0, dirtyH = 0;
+/* Seconds left to show in the timer box (-1: up to date), game to report (reportGame) */
+static int timerShown = -1;
+static uint8_t report = 0;
+/* Record of the game being played (printed by reportGame), timebase at the start of the turn */
+static uint8_t gameLog[GAME_LOG_SIZE];
+static RecordWriter gameRecord;
+static uint32_t turnStart;
+
+/* Half-width of the token on each scanline |dy| = 0..TOKEN_RADIUS: floor(sqrt(r*r - dy*dy)) */
+#if TOKEN_RADIUS != 9
+#error "tokenSpan must be regenerated for the new TOKEN_RADIUS"
+#endif
+static const uint8_t tokenSpan[TOKEN_RADIUS + 1] = {9, 8, 8, 8, 8, 7, 6, 5, 4, 0};
+
+/* Labels of the start screen sections. They are part of the image streamed by
+   initQuoridor: tools/startscreen.py reads this table, rerun it after a change */
+static const struct{
+	uint8_t rect, line;
+	uint16_t color;
+	const char *text;
+}startLabel[6] = {
+	{0, 0, White, "Player 1"},
+	{1, 0, Black, " Timer"},
+	{2, 0, Red,   "Player 2"},
+	{0, 1, Black, "Walls: 8"},
+	{1, 1, Black, "  20s"},
+	{2, 1, Black, "Walls: 8"}
+};
 
 /******************************************************************************
 ** Function name:		drawBoard
@@ -37,34 +74,33 @@ extern int timeQuoridor;
 ** Descriptions:		Disegna la tavola da gioco e inizializza la matrice 
 **                  board 7x7 di tipo Box  che la rappresenta.
 **
-** parameters:			None
+** parameters:			partita
 ** Returned value:	None
 **
 ******************************************************************************/
-void drawBoard(){
-	uint16_t i, j, k,l;
+void drawBoard(Game *g){
+	uint16_t i, j;
 	uint16_t startX = 10; 
 	uint16_t startY = 10; 
 	uint16_t x, y;
 
+	LCD_COST_BEGIN("drawBoard");
+	memcpy(g->closed, squareBorder, sizeof(g->closed));
 	for (i = 0; i < BOARD_SIZE; ++i) {
 			for (j = 0; j < BOARD_SIZE; ++j) {
 					//Init board matrix
-					board[i][j].wallH = 0;
-				  board[i][j].wallV = 0;
-				  board[i][j].player = 0;
+					g->board[i][j].wallH = 0;
+				  g->board[i][j].wallV = 0;
+				  g->board[i][j].player = 0;
 				
 					x = startX + (i * (SQUARE_SIZE + SPACE_BETWEEN));
 					y = startY + (j * (SQUARE_SIZE + SPACE_BETWEEN));
 
 					// Draw squares
-					for (k = 0; k < SQUARE_SIZE; ++k) {
-							for (l = 0; l < SQUARE_SIZE; ++l) {
-									LCD_SetPoint(x + k, y + l, Black); 
-							}
-					}
+					LCD_FillRect(x, y, SQUARE_SIZE, SQUARE_SIZE, Black);
 			}
 	}
+	LCD_COST_END();
 }
 
 /******************************************************************************
@@ -83,12 +119,9 @@ void drawSquare(uint16_t squareX, uint16_t squareY, uint16_t color){
     uint16_t x = 10 + (squareY * (SQUARE_SIZE + SPACE_BETWEEN));
 		uint16_t y = 10 + (squareX * (SQUARE_SIZE + SPACE_BETWEEN));
 
-		int16_t k,l;
-		for (k = 0; k < SQUARE_SIZE; ++k) {
-				for (l = 0; l < SQUARE_SIZE; ++l) {
-						LCD_SetPoint(x + k, y + l, color); 
-				}
-		}
+		LCD_COST_BEGIN("drawSquare");
+		LCD_FillRect(x, y, SQUARE_SIZE, SQUARE_SIZE, color);
+		LCD_COST_END();
 }
 
 /******************************************************************************
@@ -96,6 +129,8 @@ void drawSquare(uint16_t squareX, uint16_t squareY, uint16_t color){
 **
 ** Descriptions:		Data la posizione [X(riga), Y(colonna)] nella tavola e il 
 **                  colore, disegna un cerchio volto a rappresentare un giocatore.
+**                  Il cerchio viene tracciato per righe orizzontali, la cui 
+**                  semiampiezza  letta dalla tabella tokenSpan.
 **
 ** parameters:			coordinata x, coordinata y, colore
 ** Returned value:	None
@@ -110,17 +145,17 @@ void drawCircle(uint16_t squareX, uint16_t squareY, uint16_t color) {
     uint16_t centerX = screenX + SQUARE_SIZE / 2;
     uint16_t centerY = screenY + SQUARE_SIZE / 2;
 
-    // Calculate the radius of the circle 
-    uint16_t radius = (SQUARE_SIZE - SPACE_BETWEEN) / 2 - 1;
-		int16_t x,y;
-    // Draw the circle 
-    for (x = -radius; x <= radius; x++) {
-        for (y = -radius; y <= radius; y++) {
-            if (x * x + y * y <= radius * radius) {
-                LCD_SetPoint(centerY + y, centerX + x, color);
-            }
-        }
+		int16_t x;
+		uint8_t half;
+		PROFILE_BEGIN(PROFILE_DRAW_CIRCLE);
+		LCD_COST_BEGIN("drawCircle");
+    // Draw the circle one horizontal run per scanline
+    for (x = -TOKEN_RADIUS; x <= TOKEN_RADIUS; x++) {
+        half = tokenSpan[x < 0 ? -x : x];
+        LCD_FillRect(centerY - half, centerX + x, 2 * half + 1, 1, color);
     } 
+		LCD_COST_END();
+		PROFILE_END(PROFILE_DRAW_CIRCLE);
 }
 
 /******************************************************************************
@@ -143,20 +178,59 @@ void drawRectangleWithText(uint16_t rectNumber, const char *text,
     // Calculate positions for the specified rectangle
     uint16_t rectX = startX + (rectNumber * (RECTANGLE_WIDTH + SPACE_BETWEEN));
     uint16_t rectY = startY;
-		uint16_t x,y;
+		LCD_COST_BEGIN("drawRectangleWithText");
     // Draw rectangle border
-    for (x = rectX; x < rectX + RECTANGLE_WIDTH; x++) {
-        LCD_SetPoint(x, rectY, Black); // Top border
-        LCD_SetPoint(x, rectY + RECTANGLE_HEIGHT - 1, Black); // Bottom border
-    }
-    for (y = rectY; y < rectY + RECTANGLE_HEIGHT; y++) {
-        LCD_SetPoint(rectX, y, Black); // Left border
-        LCD_SetPoint(rectX + RECTANGLE_WIDTH - 1, y, Black); // Right border
-    }
+    LCD_FillRect(rectX, rectY, RECTANGLE_WIDTH, 1, Black); // Top border
+    LCD_FillRect(rectX, rectY + RECTANGLE_HEIGHT - 1, RECTANGLE_WIDTH, 1, Black); // Bottom border
+    LCD_FillRect(rectX, rectY, 1, RECTANGLE_HEIGHT, Black); // Left border
+    LCD_FillRect(rectX + RECTANGLE_WIDTH - 1, rectY, 1, RECTANGLE_HEIGHT, Black); // Right border
 
     // Put string inside the rectangle
+		updateRectangleText(rectNumber, text, lineNumber, color);
+		LCD_COST_END();
+}
+
+/******************************************************************************
+** Function name:		updateRectangleText
+**
+** Descriptions:		Aggiorna solo il testo di una riga di una sezione disegnata da 
+**                  drawRectangleWithText, senza ridisegnarne il bordo. Ogni riga  
+**                  uno slot di testo del driver: vengono ridisegnati solo i caratteri 
+**                  cambiati (es. una o due cifre del timer ogni secondo).
+**
+** parameters:			codice rettangolo, testo, numero della riga, colore
+** Returned value:	None
+**
+******************************************************************************/
+void updateRectangleText(uint16_t rectNumber, const char *text, 
+	                       uint8_t lineNumber, uint16_t color) {
+    uint16_t rectX = 10 + (rectNumber * (RECTANGLE_WIDTH + SPACE_BETWEEN));
+    uint16_t rectY = (BOARD_SIZE * (SQUARE_SIZE + SPACE_BETWEEN)) + 40;
+
+		LCD_COST_BEGIN("updateRectangleText");
 		if(lineNumber) rectY+=20;
-    GUI_Text(rectX + 5, rectY + 5, (uint8_t *)text, color, Sand);
+    GUI_TextSlot(rectNumber * 2 + lineNumber, rectX + 5, rectY + 5, (uint8_t *)text, color, Sand);
+		LCD_COST_END();
+}
+
+/******************************************************************************
+** Function name:		seedRectangleText
+**
+** Descriptions:		Registra nello slot di testo di una riga il testo gi presente 
+**                  sullo schermo (parte dell'immagine iniziale), senza disegnarlo: 
+**                  il successivo updateRectangleText ridisegna solo i caratteri cambiati.
+**
+** parameters:			codice rettangolo, testo, numero della riga, colore
+** Returned value:	None
+**
+******************************************************************************/
+static void seedRectangleText(uint16_t rectNumber, const char *text, 
+	                            uint8_t lineNumber, uint16_t color) {
+    uint16_t rectX = 10 + (rectNumber * (RECTANGLE_WIDTH + SPACE_BETWEEN));
+    uint16_t rectY = (BOARD_SIZE * (SQUARE_SIZE + SPACE_BETWEEN)) + 40;
+
+		if(lineNumber) rectY+=20;
+    GUI_TextSlotSeed(rectNumber * 2 + lineNumber, rectX + 5, rectY + 5, (uint8_t *)text, color, Sand);
 }
 
 /******************************************************************************
@@ -176,20 +250,40 @@ void drawMessageBox( const char *text, uint16_t color){
 	uint16_t startX = 10; 
 	uint16_t startY = (BOARD_SIZE * (SQUARE_SIZE + SPACE_BETWEEN))+10;
 
-	uint16_t x,y;
-	
+	LCD_COST_BEGIN("drawMessageBox");
 	// Draw rectangle border
-	for (x = startX; x < startX + MBOX_WIDTH; x++) {
-			LCD_SetPoint(x, startY, color); // Top border
-			LCD_SetPoint(x, startY + MBOX_HEIGHT - 1, color); // Bottom border
-	}
-	for (y = startY; y < startY + MBOX_HEIGHT; y++) {
-			LCD_SetPoint(startX, y, color); // Left border
-			LCD_SetPoint(startX + MBOX_WIDTH - 1, y, color); // Right border
-	}
+	LCD_FillRect(startX, startY, MBOX_WIDTH, 1, color); // Top border
+	LCD_FillRect(startX, startY + MBOX_HEIGHT - 1, MBOX_WIDTH, 1, color); // Bottom border
+	LCD_FillRect(startX, startY, 1, MBOX_HEIGHT, color); // Left border
+	LCD_FillRect(startX + MBOX_WIDTH - 1, startY, 1, MBOX_HEIGHT, color); // Right border
 
 	// Put string inside the rectangle
 	GUI_Text(startX + 5, startY + 5, (uint8_t *)text, color, Sand);
+	LCD_COST_END();
+}
+
+/******************************************************************************
+** Function name:		wallArea
+**
+** Descriptions:		Data la posizione [X(riga), Y(colonna)] nella tavola e lorientamento 
+**                  di un muro, calcola il rettangolo di schermo (2x58 o 58x2 pixel) 
+**                  coperto da drawWall.
+**
+** parameters:			coordinata x, coordinata y, orientamento, rettangolo (uscita)
+** Returned value:	None
+**
+******************************************************************************/
+static void wallArea(uint8_t x, uint8_t y, uint8_t orientation,
+	                   uint16_t *rx, uint16_t *ry, uint16_t *w, uint16_t *h){
+	if (orientation == 0) {
+		*rx = y * (SQUARE_SIZE + SPACE_BETWEEN) + 10 - 4;
+		*ry = x * (SQUARE_SIZE + SPACE_BETWEEN) + 10 - SQUARE_SIZE - 5;
+		*w = 2; *h = 2 * SQUARE_SIZE + 6;
+	} else {
+		*rx = y * (SQUARE_SIZE + SPACE_BETWEEN) + 10 - SQUARE_SIZE - 5;
+		*ry = x * (SQUARE_SIZE + SPACE_BETWEEN) + 10 - 4;
+		*w = 2 * SQUARE_SIZE + 6; *h = 2;
+	}
 }
 
 /******************************************************************************
@@ -208,36 +302,161 @@ void drawMessageBox( const char *text, uint16_t color){
 **
 ******************************************************************************/
 void drawWall(int startX, int startY, int orientation, uint16_t color) {
-    uint16_t x0, y0, x1, y1;
-    x0 = (startY) * (SQUARE_SIZE + SPACE_BETWEEN) + 10;
-    y0 = (startX) * (SQUARE_SIZE + SPACE_BETWEEN) + 10;
+    uint16_t x0, y0, w, h;
+    wallArea(startX, startY, orientation, &x0, &y0, &w, &h);
 	
+		PROFILE_BEGIN(PROFILE_DRAW_WALL);
+		LCD_COST_BEGIN("drawWall");
     if (orientation == 0) {
-        // Vertical orientation
-				x0-=4; x1 = x0;
-        y1 = y0 + SQUARE_SIZE;  
-				y0 = y0 - SQUARE_SIZE - 5;
-			  LCD_DrawLine(x0,y0,x1,y1,color);
-				x0++; x1++;
-				LCD_DrawLine(x0,y0,x1,y1,color);
-				if (color == Blue){
-					board[startX][startY].wallV =1;
-					board[startX-1][startY].wallV =1;
-				}
+        // Vertical orientation: 2-pixel bar streamed down its columns
+				LCD_DrawBar(x0, y0, h, w, 1, color);
 
     } else if (orientation == 1) {
-        // Horizontal orientation
-        x1 = x0 + SQUARE_SIZE; 
-			  x0 = x0 - SQUARE_SIZE -5; 
-				y0-=4; y1 = y0;
-				LCD_DrawLine(x0,y0,x1,y1,color);
-				y0++; y1++;
-				LCD_DrawLine(x0,y0,x1,y1,color);
-				if (color == Blue){
-					board[startX][startY].wallH = 1;
-					board[startX][startY-1].wallH = 1;
-				}	
+        // Horizontal orientation: 2-pixel bar in one window
+				LCD_DrawBar(x0, y0, w, h, 0, color);
     } 
+		LCD_COST_END();
+		PROFILE_END(PROFILE_DRAW_WALL);
+}
+
+/******************************************************************************
+** Function name:		insertWall
+**
+** Descriptions:		Inserisce un muro nella partita: segna i due lati di casella 
+**                  che chiude nella matrice board e i quattro passi in closed 
+**                  (wallEdgeSquare, wallEdgeStep), lo segna in wallSlot e lo 
+**                  aggiunge a wallsArray. 
+**                  Non disegna nulla (drawWall) e non controlla la posizione 
+**                  (checkWallPosition, checkTrap).
+**
+** parameters:			partita, coordinata x, coordinata y, orientamento
+** Returned value:	None
+**
+******************************************************************************/
+void insertWall(Game *g, uint8_t x, uint8_t y, uint8_t orientation){
+	uint8_t square = SQUARE(x, y), i;
+	if (orientation == 0) {
+		g->board[x][y].wallV = 1;
+		g->board[x-1][y].wallV = 1;
+	} else {
+		g->board[x][y].wallH = 1;
+		g->board[x][y-1].wallH = 1;
+	}
+	for (i = 0; i < 4; i++) {
+		g->closed[square + wallEdgeSquare[orientation][i]] |= STEP_BIT(wallEdgeStep[orientation][i]);
+	}
+	g->wallSlot[orientation][square] = 1;
+	g->wallsArray[g->nWalls].x = x;
+	g->wallsArray[g->nWalls].y = y;
+	g->wallsArray[g->nWalls].orientation = orientation;
+	g->nWalls++;
+}
+
+/******************************************************************************
+** Function name:		removeWall
+**
+** Descriptions:		Toglie dalla partita lultimo muro inserito con insertWall, riaprendo 
+**                  i passi che chiudeva e il suo slot in wallSlot. Serve agli strumenti 
+**                  che esplorano le mosse (inserisci, valuta, togli); il gioco non 
+**                  rimuove mai un muro. Le 
+**                  rimozioni devono seguire lordine inverso degli inserimenti: se 
+**                  lultimo muro di wallsArray non  quello dato non tocca nulla.
+**
+** parameters:			partita, coordinata x, coordinata y, orientamento
+** Returned value:	Muro rimosso (vero/falso)
+**
+******************************************************************************/
+bool removeWall(Game *g, uint8_t x, uint8_t y, uint8_t orientation){
+	uint8_t square = SQUARE(x, y), i;
+	Wall *last;
+	if (g->nWalls == 0) return false;
+	last = &g->wallsArray[g->nWalls - 1];
+	if (last->x != x || last->y != y || last->orientation != orientation) return false;
+	if (orientation == 0) {
+		g->board[x][y].wallV = 0;
+		g->board[x-1][y].wallV = 0;
+	} else {
+		g->board[x][y].wallH = 0;
+		g->board[x][y-1].wallH = 0;
+	}
+	for (i = 0; i < 4; i++) {
+		g->closed[square + wallEdgeSquare[orientation][i]] &= ~STEP_BIT(wallEdgeStep[orientation][i]);
+	}
+	g->wallSlot[orientation][square] = 0;
+	g->nWalls--;
+	return true;
+}
+
+/******************************************************************************
+** Function name:		markPreviewArea
+**
+** Descriptions:		Aggiunge al rettangolo sporco larea coperta dallanteprima di un 
+**                  muro (Ciano, Magenta o Rosso), che andr ripristinata da 
+**                  restorePreviewArea.
+**
+** parameters:			coordinata x, coordinata y, orientamento
+** Returned value:	None
+**
+******************************************************************************/
+static void markPreviewArea(uint8_t x, uint8_t y, uint8_t orientation){
+	uint16_t rx, ry, w, h;
+
+	wallArea(x, y, orientation, &rx, &ry, &w, &h);
+	if(dirtyW == 0){
+		dirtyX = rx; dirtyY = ry; dirtyW = w; dirtyH = h;
+		return;
+	}
+	if(rx + w > dirtyX + dirtyW) dirtyW = rx + w - dirtyX;
+	if(ry + h > dirtyY + dirtyH) dirtyH = ry + h - dirtyY;
+	if(rx < dirtyX){ dirtyW += dirtyX - rx; dirtyX = rx; }
+	if(ry < dirtyY){ dirtyH += dirtyY - ry; dirtyY = ry; }
+}
+
+/******************************************************************************
+** Function name:		restorePreviewArea
+**
+** Descriptions:		Ripristina il rettangolo sporco lasciato dalle anteprime dei muri: 
+**                  Sabbia (i muri occupano solo gli spazi tra le caselle) e Blu dove 
+**                  interseca un muro inserito. I muri candidati sono letti dallindice 
+**                  wallSlot della partita nei soli slot vicini al rettangolo, per cui il costo non 
+**                  dipende dal numero di muri sulla tavola. Chiamata allinterno del 
+**                  display list di executeMove: arrivano allo schermo solo i pixel che cambiano.
+**
+** parameters:			None
+** Returned value:	None
+**
+******************************************************************************/
+static void restorePreviewArea(void){
+	uint16_t cx, cy, cw, ch, x0, y0, x1, y1;
+	int sx0, sx1, sy0, sy1, x, y, o;
+
+	if(dirtyW == 0) return;
+	LCD_FillRect(dirtyX, dirtyY, dirtyW, dirtyH, Sand);
+
+	//Slots whose wall may reach the rectangle (a wall spans one square and the gaps around it)
+	sx0 = ((int)dirtyY - 10) / (SQUARE_SIZE + SPACE_BETWEEN) - 1;
+	sx1 = ((int)dirtyY + dirtyH - 10) / (SQUARE_SIZE + SPACE_BETWEEN) + 1;
+	sy0 = ((int)dirtyX - 10) / (SQUARE_SIZE + SPACE_BETWEEN) - 1;
+	sy1 = ((int)dirtyX + dirtyW - 10) / (SQUARE_SIZE + SPACE_BETWEEN) + 1;
+	if(sx0 < 1) sx0 = 1;
+	if(sy0 < 1) sy0 = 1;
+	if(sx1 > BOARD_SIZE - 1) sx1 = BOARD_SIZE - 1;
+	if(sy1 > BOARD_SIZE - 1) sy1 = BOARD_SIZE - 1;
+
+	for(o = 0; o < 2; o++){
+		for(x = sx0; x <= sx1; x++){
+			for(y = sy0; y <= sy1; y++){
+				if(!game.wallSlot[o][SQUARE(x, y)]) continue;
+				wallArea(x, y, o, &cx, &cy, &cw, &ch);
+				x0 = cx > dirtyX ? cx : dirtyX;
+				y0 = cy > dirtyY ? cy : dirtyY;
+				x1 = cx + cw < dirtyX + dirtyW ? cx + cw : dirtyX + dirtyW;
+				y1 = cy + ch < dirtyY + dirtyH ? cy + ch : dirtyY + dirtyH;
+				if(x0 < x1 && y0 < y1) LCD_FillRect(x0, y0, x1 - x0, y1 - y0, Blue);
+			}
+		}
+	}
+	dirtyW = 0; dirtyH = 0;
 }
 
 /******************************************************************************
@@ -250,40 +469,37 @@ void drawWall(int startX, int startY, int orientation, uint16_t color) {
 **									-	numero muri restanti
 **									-	direzioni percorribili dato il presente stato del gioco 
 **
-** parameters:			id del giocatore, nuova coordinata X, nuova coordinata Y, inserimento muro (vero/falso)
+** parameters:			partita, id del giocatore, nuova coordinata X, nuova coordinata Y, inserimento muro (vero/falso)
 ** Returned value:	None
 **
 ******************************************************************************/
-void updatePlayerState(uint8_t id, uint16_t newX, uint16_t newY, bool wall){
+void updatePlayerState(Game *g, uint8_t id, uint16_t newX, uint16_t newY, bool wall){
 	char walls[9] = "";
+	const Box *cell = &g->board[0][0];
+	uint8_t square = SQUARE(newX, newY), step, next, dir = 0;
 	//Remove old player[id] position from board
-	board[player[id].x][player[id].y].player=0;
+	g->board[g->player[id].x][g->player[id].y].player=0;
 	
 	//Update player[id] position and wall number
-	player[id].x = newX; player[id].y = newY;
+	g->player[id].x = newX; g->player[id].y = newY;
 	if(wall) {
-		player[id].walls--;
-		sprintf(walls,"Walls: %d",player[id].walls);
-		drawRectangleWithText(id*2, walls,1, Black);
+		g->player[id].walls--;
+		sprintf(walls,"Walls: %d",g->player[id].walls);
+		updateRectangleText(id*2, walls,1, Black);
 	} 
 	
 	//Update player[id] position on board
-	board[player[id].x][player[id].y].player=1;
-	
-	//Update acceptable directions
-	player[id].direction.word8 = 0;
-	
-	if(newY>0 && board[newX][newY].wallV==0 && board[newX][newY-1].player==0) player[id].direction.bits.left=1;
-	else if(newY>1 && board[newX][newY-1].wallV==0 && board[newX][newY-1].player==1) player[id].direction.bits.left=2;
-		
-	if(newY<6 && board[newX][newY+1].wallV==0 && board[newX][newY+1].player==0) player[id].direction.bits.right=1;
-	else if(newY<5 && board[newX][newY+2].wallV==0 && board[newX][newY+1].player==1) player[id].direction.bits.right=2;
+	g->board[g->player[id].x][g->player[id].y].player=1;
 	
-	if(newX>0 && board[newX][newY].wallH==0 && board[newX-1][newY].player==0) player[id].direction.bits.up=1;
-	else if(newX>1 && board[newX-1][newY].wallH==0 && board[newX-1][newY].player==1) player[id].direction.bits.up=2;
-		
-	if(newX<6 && board[newX+1][newY].wallH==0 && board[newX+1][newY].player==0) player[id].direction.bits.down  = 1;
-	else if(newX<5 && board[newX+2][newY].wallH==0 && board[newX+1][newY].player==1) player[id].direction.bits.down  = 2;
+	//Update acceptable directions: a free step, or a jump over the token on the next square
+	//(a closed step is never followed, so squareStep is only read on the board)
+	for(step = 0; step < STEPS; step++){
+		next = squareStep[square][step];
+		if(!(g->closed[square] & STEP_BIT(step)) && !cell[next].player) dir |= 1 << (2 * step);
+		else if(squareJump[square][step] != NO_SQUARE && !(g->closed[next] & STEP_BIT(step)) && cell[next].player) dir |= 2 << (2 * step);
+	}
+	//Direction fields are 2 bits each, from up in the low bits, in STEP_* order
+	g->player[id].direction.word8 = dir;
 }
 
 /******************************************************************************
@@ -296,64 +512,81 @@ void updatePlayerState(uint8_t id, uint16_t newX, uint16_t newY, bool wall){
 **									-	NERO: per cancellare le possibili mosse a causa del passaggio al turno seguente 
 **													o del piazzamento di un muro
 **
-** parameters:			id del giocatore, colore
+** parameters:			partita, id del giocatore, colore
 ** Returned value:	None
 **
 ******************************************************************************/
-void highlightPlayerMoves(uint8_t id, uint16_t color){
-		if(player[id].direction.bits.left==1) drawSquare(player[id].x, player[id].y-1,color);
-		if(player[id].direction.bits.left==2) drawSquare(player[id].x, player[id].y-2,color);
+void highlightPlayerMoves(Game *g, uint8_t id, uint16_t color){
+		LCD_COST_BEGIN("highlightPlayerMoves");
+		if(g->player[id].direction.bits.left==1) drawSquare(g->player[id].x, g->player[id].y-1,color);
+		if(g->player[id].direction.bits.left==2) drawSquare(g->player[id].x, g->player[id].y-2,color);
 	
-		if(player[id].direction.bits.right==1) drawSquare(player[id].x, player[id].y+1,color);
-		if(player[id].direction.bits.right==2) drawSquare(player[id].x, player[id].y+2,color);
+		if(g->player[id].direction.bits.right==1) drawSquare(g->player[id].x, g->player[id].y+1,color);
+		if(g->player[id].direction.bits.right==2) drawSquare(g->player[id].x, g->player[id].y+2,color);
 	
-		if(player[id].direction.bits.up==1) drawSquare(player[id].x-1, player[id].y,color);
-		if(player[id].direction.bits.up==2) drawSquare(player[id].x-2, player[id].y,color);
+		if(g->player[id].direction.bits.up==1) drawSquare(g->player[id].x-1, g->player[id].y,color);
+		if(g->player[id].direction.bits.up==2) drawSquare(g->player[id].x-2, g->player[id].y,color);
 	
-		if(player[id].direction.bits.down==1) drawSquare(player[id].x+1, player[id].y,color);
-		if(player[id].direction.bits.down==2) drawSquare(player[id].x+2, player[id].y,color);
+		if(g->player[id].direction.bits.down==1) drawSquare(g->player[id].x+1, g->player[id].y,color);
+		if(g->player[id].direction.bits.down==2) drawSquare(g->player[id].x+2, g->player[id].y,color);
+		LCD_COST_END();
 }
 
 /******************************************************************************
-** Function name:		initQuoridor
+** Function name:		initGame
 **
-** Descriptions:		Inizializza il gioco, disegna la tavola, i giocatori e le 
-**									sezioni relative a timer e muri dei giocatori.
+** Descriptions:		Porta una partita nella posizione iniziale: tavola vuota, 
+**									giocatori nelle caselle di partenza con 8 muri, nessuna 
+**									mossa in corso. Non disegna nulla.
 **
-** parameters:			None
+** parameters:			partita
 ** Returned value:	None
 **
 ******************************************************************************/
-void initQuoridor(void){
+void initGame(Game *g){
 	Player p;
-	//Draw board 
-	drawBoard();
+	memset(g, 0, sizeof(*g));
+	memcpy(g->closed, squareBorder, sizeof(g->closed));
 	
 	//Init player 1
-	drawCircle(6, 3, White);
 	p.id=0; p.color=White; p.x=6; p.y=3; p.walls=8; 
 	p.direction.word8=0; p.finalX=0;
-	player[0] = p;
-	board[6][3].player = 1;
+	g->player[0] = p;
+	g->board[6][3].player = 1;
 	
 	//Init player 2
-	drawCircle(0, 3,Red);
 	p.id=1;	p.color = Red; p.x=0; p.y=3; p.finalX=6;
-	player[1]=p;
-	board[0][3].player = 1;
+	g->player[1]=p;
+	g->board[0][3].player = 1;
 
-	//Draw game data
-	drawRectangleWithText(0, "Player 1",0, White);
-	drawRectangleWithText(1, " Timer",0, Black);
-	drawRectangleWithText(2, "Player 2",0, Red);
-	
-	drawRectangleWithText(0, "Walls: 8",1, Black);
-	drawRectangleWithText(1, "  20s",1, Black);
-	drawRectangleWithText(2, "Walls: 8",1, Black);
-	
 	//Init last Move
-	lastMove.word32 = 0;
-	lastMove.bits.playerID = 255;
+	g->lastMove.word32 = 0;
+	g->lastMove.bits.playerID = 255;
+	g->timeQuoridor = 21;
+}
+
+/******************************************************************************
+** Function name:		initQuoridor
+**
+** Descriptions:		Inizializza il gioco, disegna la tavola, i giocatori e le 
+**									sezioni relative a timer e muri dei giocatori.
+**
+** parameters:			None
+** Returned value:	None
+**
+******************************************************************************/
+void initQuoridor(void){
+	uint8_t i;
+	LCD_COST_BEGIN("initQuoridor");
+	//Stream the start screen (board, tokens, sections and labels) in one pass
+	LCD_DrawRLE(0, 0, START_SCREEN_WIDTH, START_SCREEN_HEIGHT, 
+	            startScreenPalette, startScreenRuns, START_SCREEN_RUNS);
+	for (i = 0; i < 6; i++) {
+		seedRectangleText(startLabel[i].rect, startLabel[i].text, startLabel[i].line, startLabel[i].color);
+	}
+	initGame(&game);
+	dirtyW = 0; dirtyH = 0;
+	LCD_COST_END();
 }
 
 /******************************************************************************
@@ -362,46 +595,50 @@ void initQuoridor(void){
 ** Descriptions:		Inizia il gioco. Calcola (updatePlayerState) ed evidenzia (highlightPlayerMoves) 
 **									le possibili mosse del primo giocatore e avvia il timer di 20 secondi per il primo turno.
 **
-** parameters:			None
+** parameters:			partita
 ** Returned value:	None
 **
 ******************************************************************************/
-void startGame(){
+void startGame(Game *g){
 	//If starting new game (not the first since power on)
-	if(gameOn==-1){
-		LCD_Clear(Sand);
+	if(g->gameOn==-1){
 		initQuoridor();
 	}
 	
-	updatePlayerState(0, player[0].x, player[0].y, false);
-	updatePlayerState(1, player[1].x, player[1].y, false);
-	activePlayer=0;
+	updatePlayerState(g, 0, g->player[0].x, g->player[0].y, false);
+	updatePlayerState(g, 1, g->player[1].x, g->player[1].y, false);
+	g->activePlayer=0;
 	
 	//Highlight player 0 moves
-	highlightPlayerMoves(0, DarkGrey);
+	highlightPlayerMoves(g, 0, DarkGrey);
 	//Reset/Start timer
-	timeQuoridor=21;
+	g->timeQuoridor=21;
 	reset_timer(0);
 	enable_timer(0);
+	//Sample the joystick while the game is on
+	poll_joystick(1);
 	
-	gameOn=1;
-	next=1;
-	wallOk=0;
+	g->gameOn=1;
+	g->next=1;
+	g->wallOk=0;
 }
 
 /******************************************************************************
 ** Function name:		stopGame
 **
-** Descriptions:		Termina il gioco e disabilita il timer.
+** Descriptions:		Termina il gioco e disabilita il timer. Le statistiche della partita 
+**									vengono stampate dal task di telemetria (reportGame).
 **
-** parameters:			None
+** parameters:			partita
 ** Returned value:	None
 **
 ******************************************************************************/
-void stopGame(){
+void stopGame(Game *g){
 	disable_timer(0);
-	gameOn=-1;
-	next=0;
+	poll_joystick(0);
+	g->gameOn=-1;
+	g->next=0;
+	report=1;
 }
 
 /******************************************************************************
@@ -411,21 +648,21 @@ void stopGame(){
 **									come attivo il giocatore in attesa, ne evidenzia le possibili mosse 
 **                  (highlightPlayerMoves) e riavvia il timer di 20 secondi.
 **
-** parameters:			None
+** parameters:			partita
 ** Returned value:	None
 **
 ******************************************************************************/
-void nextTurn(){
-	activePlayer = !activePlayer;
-	updatePlayerState(0, player[0].x, player[0].y, false);
-	updatePlayerState(1, player[1].x, player[1].y, false);
-	highlightPlayerMoves(activePlayer, DarkGrey);
+void nextTurn(Game *g){
+	g->activePlayer = !g->activePlayer;
+	updatePlayerState(g, 0, g->player[0].x, g->player[0].y, false);
+	updatePlayerState(g, 1, g->player[1].x, g->player[1].y, false);
+	highlightPlayerMoves(g, g->activePlayer, DarkGrey);
 	//Reset/Start timer
-	timeQuoridor=21;
+	g->timeQuoridor=21;
 	reset_timer(0);
 	enable_timer(0);
-	next=1;
-	wallOk=0;
+	g->next=1;
+	g->wallOk=0;
 }
 
 /******************************************************************************
@@ -436,28 +673,25 @@ void nextTurn(){
 **                  cambia posizione durante il turno, prima di confermare la mossa o 
 **									prima del timeout.
 **
-** parameters:			None
+** parameters:			partita
 ** Returned value:	None
 **
 ******************************************************************************/
-void deleteLastMove(){
-	int i;
+void deleteLastMove(Game *g){
+	LCD_COST_BEGIN("deleteLastMove");
 	//Redraw last move's Token
-	if(lastMove.bits.move==0){
-		if(lastMove.bits.x==player[lastMove.bits.playerID].x && lastMove.bits.y==player[lastMove.bits.playerID].y){
-			drawCircle(player[lastMove.bits.playerID].x, player[lastMove.bits.playerID].y, Black);
+	if(g->lastMove.bits.move==0){
+		if(g->lastMove.bits.x==g->player[g->lastMove.bits.playerID].x && g->lastMove.bits.y==g->player[g->lastMove.bits.playerID].y){
+			drawCircle(g->player[g->lastMove.bits.playerID].x, g->player[g->lastMove.bits.playerID].y, Black);
 		}
 		else{
-		drawCircle(lastMove.bits.x, lastMove.bits.y, DarkGrey);
-		drawCircle(player[lastMove.bits.playerID].x, player[lastMove.bits.playerID].y, player[lastMove.bits.playerID].color);}
+		drawCircle(g->lastMove.bits.x, g->lastMove.bits.y, DarkGrey);
+		drawCircle(g->player[g->lastMove.bits.playerID].x, g->player[g->lastMove.bits.playerID].y, g->player[g->lastMove.bits.playerID].color);}
 	}
 	else{
-		drawWall(lastMove.bits.x, lastMove.bits.y, lastMove.bits.orientation, Sand);
-		for(i=0; i<nWalls; i++){
-				drawWall(wallsArray[i].x, wallsArray[i].y,wallsArray[i].orientation, Blue);
-		}
-	
+		restorePreviewArea();
 	}
+	LCD_COST_END();
 }
 
 /******************************************************************************
@@ -473,47 +707,54 @@ void deleteLastMove(){
 **                  del joystick) e il giocatore ha confermato la sua scelta. La tavola da 
 **                  gioco viene aggiornata, si verifica se la mossa abbia portato alla vittoria 
 **                  (checkWinner) e in caso negativo si passa al turno seguente (nextTurn).
+**                  Le chiamate di disegno sono registrate nel display list del driver e 
+**                  inviate allo schermo una sola volta, al termine della funzione, che 
+**                  chiude la misura di latenza dell'input che l'ha causata (latency_end).
 **
-** parameters:			mossa, conferma
+** parameters:			partita, mossa, conferma
 ** Returned value:	None
 **
 ******************************************************************************/
-void executeMove(Move m, bool confirm){
-	int i; bool trap;
+void executeMove(Game *g, Move m, bool confirm){
+	bool trap;
+	PROFILE_BEGIN(PROFILE_EXECUTE_MOVE);
+	LCD_COST_BEGIN("executeMove");
+	//Record every draw call and send only the final image
+	LCD_ListBegin();
 	//Time expired
 	if(m.bits.move==0 && m.bits.orientation==1){
-		if(lastMove.bits.playerID!=255)deleteLastMove();
-		drawCircle(player[lastMove.bits.playerID].x, 
-		           player[lastMove.bits.playerID].y, 
-		           player[lastMove.bits.playerID].color);
+		if(g->lastMove.bits.playerID!=255)deleteLastMove(g);
+		drawCircle(g->player[g->lastMove.bits.playerID].x, 
+		           g->player[g->lastMove.bits.playerID].y, 
+		           g->player[g->lastMove.bits.playerID].color);
 		
 		//Remove possible moves highlight 
-		highlightPlayerMoves(activePlayer, Black);
+		highlightPlayerMoves(g, g->activePlayer, Black);
 		
-		lastMove.word32 = 0; 
-		lastMove.bits.playerID = 255;
-		nextTurn();
+		g->lastMove.word32 = 0; 
+		g->lastMove.bits.playerID = 255;
+		nextTurn(g);
 	}
 	
 	//Move Player
 	else if(m.bits.move==0){
 		if(confirm){
-			highlightPlayerMoves(m.bits.playerID, Black);
+			highlightPlayerMoves(g, m.bits.playerID, Black);
 			
 			//Save new move
-			updatePlayerState(m.bits.playerID, m.bits.x, m.bits.y, false);
-			drawCircle(m.bits.x, m.bits.y, player[m.bits.playerID].color);
-			lastMove.word32 = 0; 
-			lastMove.bits.playerID = 255;
-			checkWinner();
-			if(gameOn==1) nextTurn();
+			updatePlayerState(g, m.bits.playerID, m.bits.x, m.bits.y, false);
+			drawCircle(m.bits.x, m.bits.y, g->player[m.bits.playerID].color);
+			g->lastMove.word32 = 0; 
+			g->lastMove.bits.playerID = 255;
+			checkWinner(g);
+			if(g->gameOn==1) nextTurn(g);
 		}else{
-			if(lastMove.bits.playerID!=255) deleteLastMove();
-			else drawCircle(player[m.bits.playerID].x, player[m.bits.playerID].y, Black);
+			if(g->lastMove.bits.playerID!=255) deleteLastMove(g);
+			else drawCircle(g->player[m.bits.playerID].x, g->player[m.bits.playerID].y, Black);
 			
-			if(lastMove.bits.move==1) highlightPlayerMoves(m.bits.playerID, DarkGrey);
-			drawCircle(m.bits.x, m.bits.y, player[m.bits.playerID].color);
-			lastMove = m;
+			if(g->lastMove.bits.move==1) highlightPlayerMoves(g, m.bits.playerID, DarkGrey);
+			drawCircle(m.bits.x, m.bits.y, g->player[m.bits.playerID].color);
+			g->lastMove = m;
 		}
 	}
 	
@@ -521,46 +762,45 @@ void executeMove(Move m, bool confirm){
 	else{
 		if(confirm) {
 			drawWall(m.bits.x, m.bits.y, m.bits.orientation, Blue); 
-			highlightPlayerMoves(m.bits.playerID, Black);
-			//Save new move
-			updatePlayerState(m.bits.playerID, player[m.bits.playerID].x, player[m.bits.playerID].y, true);
-			
 			//Save Wall
-			wallsArray[nWalls].x = m.bits.x;
-			wallsArray[nWalls].y = m.bits.y;
-			wallsArray[nWalls].orientation = m.bits.orientation;
-			nWalls++;
+			insertWall(g, m.bits.x, m.bits.y, m.bits.orientation);
+			restorePreviewArea();
+			highlightPlayerMoves(g, m.bits.playerID, Black);
+			//Save new move
+			updatePlayerState(g, m.bits.playerID, g->player[m.bits.playerID].x, g->player[m.bits.playerID].y, true);
 			
-			lastMove.word32 = 0; 
-			lastMove.bits.playerID = 255;
-			nextTurn();
+			g->lastMove.word32 = 0; 
+			g->lastMove.bits.playerID = 255;
+			nextTurn(g);
 		}
 		else {
-			if(lastMove.bits.playerID!=255 
-			  && !(lastMove.bits.move==0 && (lastMove.bits.x==player[lastMove.bits.playerID].x 
-			  && lastMove.bits.y==player[lastMove.bits.playerID].y))
+			if(g->lastMove.bits.playerID!=255 
+			  && !(g->lastMove.bits.move==0 && (g->lastMove.bits.x==g->player[g->lastMove.bits.playerID].x 
+			  && g->lastMove.bits.y==g->player[g->lastMove.bits.playerID].y))
 			){
-					deleteLastMove();
+					deleteLastMove(g);
 			}
-			if(lastMove.bits.move==0) highlightPlayerMoves(m.bits.playerID, Black);
+			if(g->lastMove.bits.move==0) highlightPlayerMoves(g, m.bits.playerID, Black);
 			
-			//Redraw all walls 
-			if(wallOk==0){
-				for(i=0; i<nWalls; i++){
-					drawWall(wallsArray[i].x, wallsArray[i].y,wallsArray[i].orientation, Blue);
-				}
-			}
+			//Repaint what previous previews left, with the walls overlapping it
+			restorePreviewArea();
 			
-			wallOk = checkWallPosition(m.bits.x, m.bits.y, m.bits.orientation) ? 1 : 0;
-			if(wallOk==1) drawWall(m.bits.x, m.bits.y, m.bits.orientation, Cyan);
+			g->wallOk = checkWallPosition(g, m.bits.x, m.bits.y, m.bits.orientation) ? 1 : 0;
+			if(g->wallOk==1) drawWall(m.bits.x, m.bits.y, m.bits.orientation, Cyan);
 			else drawWall(m.bits.x, m.bits.y, m.bits.orientation, Magenta);
 			
-			trap = checkTrap(m.bits.x, m.bits.y, m.bits.orientation);
+			trap = checkTrap(g, m.bits.x, m.bits.y, m.bits.orientation);
 			if(!trap)drawWall(m.bits.x, m.bits.y, m.bits.orientation, Red);
+			markPreviewArea(m.bits.x, m.bits.y, m.bits.orientation);
 			
-			lastMove = m;
+			g->lastMove = m;
 		}
 	}
+	LCD_ListEnd();
+	//Last GRAM write of the redraw: input-to-pixel latency
+	latency_end();
+	LCD_COST_END();
+	PROFILE_END(PROFILE_EXECUTE_MOVE);
 }
 
 /******************************************************************************
@@ -571,16 +811,16 @@ void executeMove(Move m, bool confirm){
 **                  dal giocatore  accettabile (il muro non si sovrappone agli altri gi 
 **                  presenti) oppure no. Restituisce True se il posizionamento  accettabile.
 **
-** parameters:			coordinata x, coordinata y, orientamento
+** parameters:			partita, coordinata x, coordinata y, orientamento
 ** Returned value:	None
 **
 ******************************************************************************/
-bool checkWallPosition(uint8_t x, uint8_t y, uint8_t orientation){
+bool checkWallPosition(Game *g, uint8_t x, uint8_t y, uint8_t orientation){
 	//Check HORIZONTAL
- 	if(orientation==1 && (board[x][y].wallH==1 || board[x][y-1].wallH==1 || (board[x-1][y].wallV==1 && board[x][y].wallV==1)))
+ 	if(orientation==1 && (g->board[x][y].wallH==1 || g->board[x][y-1].wallH==1 || (g->board[x-1][y].wallV==1 && g->board[x][y].wallV==1)))
 		return false;
 	//Check VERTICAL
-	if(orientation==0 && (board[x][y].wallV==1 || board[x-1][y].wallV==1 || (board[x][y-1].wallH==1 && board[x][y].wallH==1)))
+	if(orientation==0 && (g->board[x][y].wallV==1 || g->board[x-1][y].wallV==1 || (g->board[x][y-1].wallH==1 && g->board[x][y].wallH==1)))
 		return false;
 	return true;
 }
@@ -591,39 +831,35 @@ bool checkWallPosition(uint8_t x, uint8_t y, uint8_t orientation){
 ** Descriptions:		Data la posizione [X(riga), Y(colonna)] nella tavola, lorientamento 
 **                  (orizzontale o verticale) verifica se la posizione del muro impostata 
 **                  dal giocatore intrappola il giocatore avversario impedendogli permanentemente 
-**                  di raggiungere la vittoria. Inserisce temporaneamente il muro nella matrice board 
+**                  di raggiungere la vittoria. Chiude temporaneamente i passi del muro in closed 
 **                  e chiama la funzione search dandogli in input la posizione corrente del giocatore 
-**                  avversario e una matrice booleana inizializzata a False. Restituisce True se  stato 
+**                  avversario e un vettore booleano inizializzato a False. Restituisce True se  stato 
 **                  trovato almeno un percorso che porta lavversario alla vittoria.
 **
-** parameters:			coordinata x del muro, coordinata y del muro, orientamento
+** parameters:			partita, coordinata x del muro, coordinata y del muro, orientamento
 ** Returned value:	Percorso trovato dalla posizione iniziale alla meta (vero/falso)
 **
 ******************************************************************************/
-bool checkTrap(uint8_t x, uint8_t y, uint8_t orientation) {
-    bool visited[7][7] = {false};
+bool checkTrap(Game *g, uint8_t x, uint8_t y, uint8_t orientation) {
+    bool visited[BOARD_SQUARES] = {false};
 		bool pathFound=false;
+		uint8_t square = SQUARE(x, y), old[4], i;
 		
-		//Temporarily insert the wall
-		if (orientation == 0) {
-				board[x][y].wallV = 1;
-				board[x - 1][y].wallV = 1;
-		} else {
-				board[x][y].wallH = 1;
-				board[x][y - 1].wallH = 1;
+		PROFILE_BEGIN(PROFILE_CHECK_TRAP);
+		//Temporarily close the steps of the wall, keeping those it may overlap
+		for (i = 0; i < 4; i++) {
+				old[i] = g->closed[square + wallEdgeSquare[orientation][i]];
+				g->closed[square + wallEdgeSquare[orientation][i]] |= STEP_BIT(wallEdgeStep[orientation][i]);
 		}
 
-    pathFound = search(player[!activePlayer].x, player[!activePlayer].y, visited);
+    pathFound = search(g, SQUARE(g->player[!g->activePlayer].x, g->player[!g->activePlayer].y), visited);
 
 		//Remove the temporary wall
-		if (orientation == 0) {
-				board[x][y].wallV = 0;
-				board[x - 1][y].wallV = 0;
-		} else {
-				board[x][y].wallH = 0;
-  				board[x][y - 1].wallH = 0;
+		for (i = 0; i < 4; i++) {
+				g->closed[square + wallEdgeSquare[orientation][i]] = old[i];
 		}
 
+		PROFILE_END(PROFILE_CHECK_TRAP);
     return pathFound;
 }
 
@@ -631,29 +867,31 @@ bool checkTrap(uint8_t x, uint8_t y, uint8_t orientation) {
 ** Function name:		search
 **
 ** Descriptions:		Funzione ricorsiva che riceve in input la posizione visitata dal 
-**                  giocatore avversario e una matrice booleana rappresentante le caselle 
-**                  visitabili dal giocatore. Il valore di ritorno della funzione indica se 
+**                  giocatore avversario e un vettore booleano rappresentante le caselle 
+**                  gi visitate. I passi seguono le tabelle squareStep e closed. Il valore di ritorno della funzione indica se 
 **                  sia possibile per il giocatore avversario raggiungere la sua destinazione 
-**									finale partendo dalle coordinate date.
+**									finale partendo dalla casella data.
 **
-** parameters:			coordinata x del giocatore, coordinata y del giocatore, matrice delle posizioni visitate
+** parameters:			partita, casella del giocatore (SQUARE), caselle visitate
 ** Returned value:	Percorso trovato dalla posizione iniziale alla meta (vero/falso)
 **
 ******************************************************************************/
-bool search(uint8_t x, uint8_t y, bool visited[7][7]){
+bool search(Game *g, uint8_t square, bool visited[BOARD_SQUARES]){
 		bool res=false;
-	  if (x == player[!activePlayer].finalX )return true;
-    visited[x][y] = true;
-
-    // Check in all possible directions
-    if (x > 0 && board[x][y].wallH == 0 && !visited[x - 1][y])     {res |= search(x - 1, y, visited);}
-		if(res) return true;
-    if (x < 6 && board[x + 1][y].wallH == 0 && !visited[x + 1][y]) {res |= search(x + 1, y, visited);}
-		if(res) return true;
-    if (y > 0 && board[x][y].wallV == 0 && !visited[x][y - 1])     {res |= search(x, y - 1, visited);}
-		if(res) return true;
-    if (y < 6 && board[x][y + 1].wallV == 0 && !visited[x][y + 1]) {res |= search(x, y + 1, visited);}
-		
+		uint8_t step;
+		PROFILE_BEGIN(PROFILE_SEARCH);
+	  if (squareRow[square] == g->player[!g->activePlayer].finalX ) res=true;
+	  else {
+	    visited[square] = true;
+
+	    // Check in all possible directions (up, down, left, right), stop at the first path found
+	    for (step = 0; !res && step < STEPS; step++) {
+	      if (!(g->closed[square] & STEP_BIT(step)) && !visited[squareStep[square][step]]) {
+	        res = search(g, squareStep[square][step], visited);
+	      }
+	    }
+	  }
+		PROFILE_END(PROFILE_SEARCH);
 		return res;
 }
 
@@ -664,19 +902,355 @@ bool search(uint8_t x, uint8_t y, bool visited[7][7]){
 **                  che ha appena effettuato una mossa. Il caso di esito positivo stampa 
 **									lavviso di vittoria (drawMessageBox) e termina il gioco.
 **
-** parameters:			None
+** parameters:			partita
 ** Returned value:	None
 **
 ******************************************************************************/
-void checkWinner(){
+void checkWinner(Game *g){
 	char str[25] = "";
-	if(player[activePlayer].x == player[activePlayer].finalX){
-		sprintf(str,"     WINNER: Player %d   ", activePlayer+1);
-		drawMessageBox(str, player[activePlayer].color);
-		stopGame();
+	if(g->player[g->activePlayer].x == g->player[g->activePlayer].finalX){
+		sprintf(str,"     WINNER: Player %d   ", g->activePlayer+1);
+		drawMessageBox(str, g->player[g->activePlayer].color);
+		stopGame(g);
+	}
+}
+
+/******************************************************************************
+** Function name:		clearWarning
+**
+** Descriptions:		Cancella l'avviso "NO WALLS!" se presente.
+**
+** parameters:			partita
+** Returned value:	None
+**
+******************************************************************************/
+static void clearWarning(Game *g){
+	if(g->warning==1) {
+		drawMessageBox("   NO WALLS! Move token.", Sand); 
+		g->warning=0;
 	}
 }
 
+/******************************************************************************
+** Function name:		recordMove
+**
+** Descriptions:		Aggiunge al record della partita (record_move) la mossa confermata 
+**									del giocatore di turno, con il tempo di riflessione misurato dal 
+**									timebase dall'inizio del turno.
+**
+** parameters:			mossa
+** Returned value:	None
+**
+******************************************************************************/
+static void recordMove(Move m){
+	uint32_t now = read_timebase();
+	record_move(&gameRecord, m, (now - turnStart) / 1000);
+	turnStart = now;
+}
+
+/******************************************************************************
+** Function name:		handleInput
+**
+** Descriptions:		Elabora la pressione (gi filtrata dal debouncing del RIT) di un pulsante 
+**									o di una direzione del joystick. In particolare:
+**										-	INT0: inizia il gioco (startGame)
+**										-	KEY1: piazzamento muro in posizione centrale, stampa warning se nessun muro  disponibile. 
+**										  Cliccarlo una seconda volta riporta il giocatore alla movimentazione del token.
+**										-	KEY2: Se in modalit piazzamento muro, lo fa ruotare di 90.
+**										-	Joystick UP/DOWN/LEFT/RIGHT: verifica che il comando richiesto sia conforme alle direzioni accettabili 
+**										  calcolate per il giocatore attivo (updatePlayerState) e invia l'esecuzione temporanea della mossa (executeMove).
+**										-	Joystick SELECT: in caso di movimentazione token conferma l'ultima mossa (executeMove) eseguita con 
+**										  successo tramite Joystick UP/DOWN/LEFT/RIGHT. In caso di piazzamento muro prima di confermare la mossa (executeMove) 
+**											verifica che il suo inserimento non causi sovrapposizioni con altri muri (checkWallPosition) o trappole (checkTrap).
+**
+** parameters:			input (INPUT_*)
+** Returned value:	None
+**
+******************************************************************************/
+static void handleInput(uint8_t input){
+	Game *g = &game;
+	/* Current move management*/
+	if(g->next==1){
+		//Next turn -> reset jmove
+		g->jMove.word32=0;
+		g->jMove.bits.playerID=g->activePlayer;
+		g->jMove.bits.x=g->player[g->activePlayer].x;
+		g->jMove.bits.y=g->player[g->activePlayer].y;
+		g->next=0;
+	}
+	
+	if(input==INPUT_INT0){
+		if(g->gameOn<1){
+			startGame(g);
+			record_begin(&gameRecord, gameLog, sizeof(gameLog), RECORD_TIMES, g);
+			turnStart = read_timebase();
+		}
+		return;
+	}
+	if(g->gameOn!=1) return;
+	
+	switch(input){
+		case INPUT_SELECT:
+			clearWarning(g);
+			//If inserting wall check acceptable wall position and trap
+			if(g->jMove.bits.move==1 && 
+				(checkWallPosition(g, g->jMove.bits.x, g->jMove.bits.y, g->jMove.bits.orientation)==false ||
+				 checkTrap(g, g->jMove.bits.x, g->jMove.bits.y, g->jMove.bits.orientation)==false)){
+				break;
+			}
+			recordMove(g->jMove);
+			executeMove(g, g->jMove, true);
+			//The move won the game (checkWinner): the active player is the winner
+			if(g->gameOn==-1) record_end(&gameRecord, g->activePlayer);
+			break;
+		
+		case INPUT_DOWN:
+			clearWarning(g);
+			if(g->jMove.bits.move==0 &&
+				g->player[g->activePlayer].x==g->jMove.bits.x &&
+				g->player[g->activePlayer].y==g->jMove.bits.y &&
+				g->player[g->activePlayer].direction.bits.down>0){
+				g->jMove.bits.x += g->player[g->activePlayer].direction.bits.down;
+				executeMove(g, g->jMove, false);
+			}
+			else if(g->jMove.bits.move==0 &&
+				(g->jMove.bits.x + g->player[g->activePlayer].direction.bits.down == g->player[g->activePlayer].x ||
+				 g->jMove.bits.x + g->player[g->activePlayer].direction.bits.up == g->player[g->activePlayer].x)&&
+				g->jMove.bits.y == g->player[g->activePlayer].y ){
+				g->jMove.bits.x = g->player[g->activePlayer].x;
+				g->jMove.bits.y = g->player[g->activePlayer].y;
+				executeMove(g, g->jMove, false);
+			}
+			else if(g->jMove.bits.move==1 && g->jMove.bits.x+1<7){
+				g->jMove.bits.x++;
+				executeMove(g, g->jMove, false);
+			}
+			break;
+		
+		case INPUT_LEFT:
+			clearWarning(g);
+			if(g->jMove.bits.move==0 &&
+				g->player[g->activePlayer].x==g->jMove.bits.x &&
+				g->player[g->activePlayer].y==g->jMove.bits.y &&
+				g->player[g->activePlayer].direction.bits.left>0){
+				g->jMove.bits.y -= g->player[g->activePlayer].direction.bits.left;
+				executeMove(g, g->jMove, false);
+			}
+			else if(g->jMove.bits.move==0 &&
+				g->jMove.bits.x == g->player[g->activePlayer].x &&
+				(g->jMove.bits.y - g->player[g->activePlayer].direction.bits.left == g->player[g->activePlayer].y ||
+				 g->jMove.bits.y - g->player[g->activePlayer].direction.bits.right == g->player[g->activePlayer].y)){
+				g->jMove.bits.x = g->player[g->activePlayer].x;
+				g->jMove.bits.y = g->player[g->activePlayer].y;
+				executeMove(g, g->jMove, false);
+			}
+			else if(g->jMove.bits.move==1 && g->jMove.bits.y-1>0){
+				g->jMove.bits.y--;
+				executeMove(g, g->jMove, false);
+			}
+			break;
+		
+		case INPUT_RIGHT:
+			clearWarning(g);
+			if(g->jMove.bits.move==0 &&
+				g->player[g->activePlayer].x==g->jMove.bits.x &&
+				g->player[g->activePlayer].y==g->jMove.bits.y &&
+				g->player[g->activePlayer].direction.bits.right>0){
+				g->jMove.bits.y += g->player[g->activePlayer].direction.bits.right;
+				executeMove(g, g->jMove, false);
+			}
+			else if(g->jMove.bits.move==0 &&
+				(g->jMove.bits.y + g->player[g->activePlayer].direction.bits.right == g->player[g->activePlayer].y ||
+				 g->jMove.bits.y + g->player[g->activePlayer].direction.bits.left == g->player[g->activePlayer].y) &&
+				g->jMove.bits.x == g->player[g->activePlayer].x ){
+				g->jMove.bits.x = g->player[g->activePlayer].x;
+				g->jMove.bits.y = g->player[g->activePlayer].y;
+				executeMove(g, g->jMove, false);
+			}
+			else if(g->jMove.bits.move==1 && g->jMove.bits.y+1<7){
+				g->jMove.bits.y++;
+				executeMove(g, g->jMove, false);
+			}
+			break;
+		
+		case INPUT_UP:
+			clearWarning(g);
+			//Player mode with player in starting position
+			if(g->jMove.bits.move==0 &&
+				g->player[g->activePlayer].x==g->jMove.bits.x &&
+				g->player[g->activePlayer].y==g->jMove.bits.y &&
+				g->player[g->activePlayer].direction.bits.up>0){
+				g->jMove.bits.x -= g->player[g->activePlayer].direction.bits.up;
+				executeMove(g, g->jMove, false);
+			}
+			else if(g->jMove.bits.move==0 &&
+				(g->jMove.bits.x - g->player[g->activePlayer].direction.bits.up == g->player[g->activePlayer].x ||
+				 g->jMove.bits.x - g->player[g->activePlayer].direction.bits.down == g->player[g->activePlayer].x) &&
+				g->jMove.bits.y == g->player[g->activePlayer].y ){
+				g->jMove.bits.x = g->player[g->activePlayer].x;
+				g->jMove.bits.y = g->player[g->activePlayer].y;
+				executeMove(g, g->jMove, false);
+			}
+			else if(g->jMove.bits.move==1 && g->jMove.bits.x-1>0){
+				g->jMove.bits.x--;
+				executeMove(g, g->jMove, false);
+			}
+			break;
+		
+		case INPUT_KEY1:
+			//HANDLE KEY1  -- Wall Placement
+			//Check wall availability
+			if(g->player[g->activePlayer].walls==0 && g->jMove.bits.move==0) {
+				g->warning = 1;
+				drawMessageBox("   NO WALLS! Move token.", Magenta);
+			} 
+			else if(g->jMove.bits.move==0){
+				//Place central wall
+				g->jMove.bits.move=1;
+				g->jMove.bits.orientation=1;
+				g->jMove.bits.y=4;
+				g->jMove.bits.x=3;
+				executeMove(g, g->jMove, false);
+			}
+			else if(g->jMove.bits.move==1) {
+				//Exit wall placement mode
+				g->jMove.bits.move=0;
+				g->jMove.bits.orientation=0;
+				g->jMove.bits.x=g->player[g->activePlayer].x;
+				g->jMove.bits.y=g->player[g->activePlayer].y;
+				executeMove(g, g->jMove, false);
+			}
+			break;
+		
+		case INPUT_KEY2:
+			//HANDLE KEY2 -- Wall rotation
+			if(g->player[g->activePlayer].walls!=0 && g->jMove.bits.move==1){
+				g->jMove.bits.orientation=!g->jMove.bits.orientation;
+				executeMove(g, g->jMove, false);
+			}
+			break;
+	}
+}
+
+/******************************************************************************
+** Function name:		handleTick
+**
+** Descriptions:		Scatto di un secondo del timer: aggiorna il tempo da mostrare (disegnato 
+**									dal task di rendering, drawHud) e quando scattano i 20 secondi esegue la mossa di tipo 
+**									Move che rappresenta il timeout del turno. Questa viene gestita da executeMove.
+**
+** parameters:			None
+** Returned value:	None
+**
+******************************************************************************/
+static void handleTick(void){
+	Game *g = &game;
+	//Tick queued before the end of the game
+	if(g->gameOn!=1) return;
+	
+	if(g->timeQuoridor>0)g->timeQuoridor--;
+	timerShown=g->timeQuoridor;
+	
+	if(g->timeQuoridor==0){
+		Move m;
+		m.word32 = 0;
+		m.bits.orientation=1;
+		recordMove(m);
+		executeMove(g, m, true);
+	}
+}
+
+/******************************************************************************
+** Function name:		handleEvent
+**
+** Descriptions:		Elabora un evento prelevato dalla coda (event_get) nel main loop. 
+**									Le interrupt si limitano a inserire gli eventi: tutta la logica di 
+**									gioco e gli accessi allo schermo avvengono fuori dalle ISR.
+**									Per gli input viene misurata la latenza fino all'ultima scrittura in 
+**									GRAM del ridisegno (latency_begin, latency_end in executeMove).
+**
+** parameters:			evento
+** Returned value:	None
+**
+******************************************************************************/
+void handleEvent(Event e){
+	switch(e.type){
+		case EVENT_PRESS:
+		case EVENT_REPEAT:
+			latency_begin(e.arg, e.time);
+			handleInput(e.arg);
+			latency_cancel();
+			break;
+		case EVENT_TICK:
+			handleTick();
+			break;
+	}
+}
+
+/******************************************************************************
+** Function name:		hudPending
+**
+** Descriptions:		Condizione di attivazione del task di rendering: il testo del timer 
+**									 da aggiornare.
+**
+** parameters:			None
+** Returned value:	1 se drawHud ha del lavoro
+**
+******************************************************************************/
+uint8_t hudPending(void){
+	return timerShown>=0;
+}
+
+/******************************************************************************
+** Function name:		drawHud
+**
+** Descriptions:		Task di rendering: ridisegna le cifre del timer con l'ultimo valore 
+**									prodotto da handleTick. Gira con priorit inferiore all'input, pi 
+**									secondi scattati prima del disegno producono un solo aggiornamento.
+**
+** parameters:			None
+** Returned value:	None
+**
+******************************************************************************/
+void drawHud(void){
+	char t[6] = " ";
+	
+	sprintf(t,"  %02ds",timerShown);
+	timerShown=-1;
+	updateRectangleText(1, t, 1, Black);
+}
+
+/******************************************************************************
+** Function name:		reportPending
+**
+** Descriptions:		Condizione di attivazione del task di telemetria: partita terminata.
+**
+** parameters:			None
+** Returned value:	1 se reportGame ha del lavoro
+**
+******************************************************************************/
+uint8_t reportPending(void){
+	return report;
+}
+
+/******************************************************************************
+** Function name:		reportGame
+**
+** Descriptions:		Task di telemetria: stampa le statistiche di disegno (LCD_CostReport) 
+**									e di input (RIT_report) della partita terminata e il suo record 
+**									(record_report).
+**
+** parameters:			None
+** Returned value:	None
+**
+******************************************************************************/
+void reportGame(void){
+	report=0;
+	LCD_CostReport();
+	RIT_report();
+	record_report(&gameRecord);
+}
+
 /******************************************************************************
 **                            End Of File
 ******************************************************************************/
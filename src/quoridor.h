@@ -15,6 +15,8 @@
 #include <stdio.h>
 #include <stdint.h>
 #include <stdbool.h>
+#include "event/event.h"
+#include "boardtables.h"
 
 /* Private typedef -----------------------------------------------------------*/
 
@@ -93,36 +95,71 @@ typedef union{
 }Move;
 
 
+/*******************************************************************************
+**   Game contiene lo stato di una partita: tavola, giocatori, muri piazzati,
+**   ultima mossa, turno e tempo rimanente. Tutte le funzioni delle regole
+**   ricevono la partita su cui operano: il firmware ne usa una sola istanza,
+**   gli strumenti sull'host possono giocarne quante ne servono.
+**   closed riporta, per ogni casella (SQUARE), i passi bloccati dal bordo o da
+**   un muro (STEP_BIT):  la vista di wallH/wallV usata con le tabelle di
+**   boardtables.c, aggiornata da insertWall e removeWall.
+**   wallSlot segna, per orientamento e slot (SQUARE), i muri inseriti: con
+**   questo indice restorePreviewArea ridisegna i muri sotto le anteprime.
+**   Anche wallSlot viene tenuto da insertWall e removeWall.
+**   jMove e warning sono lo stato dell'input del giocatore di turno: la mossa
+**   in preparazione con il joystick e l'avviso "NO WALLS!" sullo schermo.
+********************************************************************************/
+typedef struct{
+	Box board[7][7];
+	Player player[2];
+	uint8_t closed[BOARD_SQUARES];  // STEP_BIT of the blocked steps of each square
+	uint8_t wallSlot[2][BOARD_SQUARES];  // 1 where a wall is inserted, [orientation][SQUARE]
+	Wall wallsArray[16];
+	uint8_t nWalls;
+	Move lastMove;
+	uint8_t activePlayer;
+	int gameOn;                   // 0 not started, 1 running, -1 ended
+	int next;                     // 1 when the turn has to pass to the other player
+	int wallOk;                   // 1 if the wall in preview can be placed
+	int timeQuoridor;             // seconds left in the turn
+	Move jMove;                   // move in preparation with the joystick, reset on the active player at each new turn (next)
+	int warning;                  // 1 while the "NO WALLS!" message is shown
+}Game;
 
-/* Private variables ---------------------------------------------------------*/
-extern Box board[7][7];
-extern Player player[2];
-extern Direction direction; //used by joystick to set valid move, updated after move
-extern uint8_t activePlayer;
 
 /* Private function prototypes -----------------------------------------------*/	
 
-void drawBoard(void);
+void drawBoard(Game *g);
 void drawSquare(uint16_t squareX, uint16_t squareY, uint16_t color);
 void drawCircle(uint16_t x, uint16_t y, uint16_t color);
 void drawRectangleWithText(uint16_t rectNumber, const char* text, uint8_t lineNumber, uint16_t color);
+void updateRectangleText(uint16_t rectNumber, const char* text, uint8_t lineNumber, uint16_t color);
 void drawMessageBox(const char* text, uint16_t color);
 void drawWall(int startX, int startY, int orientation,  uint16_t color);
+void insertWall(Game *g, uint8_t x, uint8_t y, uint8_t orientation);
+bool removeWall(Game *g, uint8_t x, uint8_t y, uint8_t orientation);
 
-void updatePlayerState(uint8_t id, uint16_t newX, uint16_t newY, bool wall);
-void highlightPlayerMoves(uint8_t id, uint16_t color);
+void updatePlayerState(Game *g, uint8_t id, uint16_t newX, uint16_t newY, bool wall);
+void highlightPlayerMoves(Game *g, uint8_t id, uint16_t color);
 
+void initGame(Game *g);
 void initQuoridor(void);
-void startGame(void);
-void stopGame(void);
-
-void nextTurn(void);
-void deleteLastMove(void);
-void executeMove(Move m, bool confirm);
-void checkWinner(void);
-bool checkWallPosition(uint8_t x, uint8_t y, uint8_t orientation);
-bool checkTrap(uint8_t x, uint8_t y, uint8_t orientation);
-bool search(uint8_t x, uint8_t y, bool visited[7][7]);
+void startGame(Game *g);
+void stopGame(Game *g);
+
+void nextTurn(Game *g);
+void deleteLastMove(Game *g);
+void executeMove(Game *g, Move m, bool confirm);
+void checkWinner(Game *g);
+bool checkWallPosition(Game *g, uint8_t x, uint8_t y, uint8_t orientation);
+bool checkTrap(Game *g, uint8_t x, uint8_t y, uint8_t orientation);
+bool search(Game *g, uint8_t square, bool visited[BOARD_SQUARES]);
+
+void handleEvent(Event e);
+uint8_t hudPending(void);
+void drawHud(void);
+uint8_t reportPending(void);
+void reportGame(void);
 
 #endif /* end __QUORIDOR_H */
 /*****************************************************************************
@@ -0,0 +1,280 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           lib_record.c
+** Last modified Date:  2026-10-19
+** Last Version:        V1.00
+** Descriptions:        Compact game record: encoder and decoder of the move stream. No hardware access,
+**                      the same code runs on the board and in host tools
+** Correlated files:    record.h, quoridor.c, boardtables.c
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#include "record.h"
+#include <stdio.h>
+
+/******************************************************************************
+** Function name:		record_begin
+**
+** Descriptions:		Starts a record in buf with the header of the game about to be
+**									played: token squares, walls of each player and the player who
+**									moves first.
+**
+** parameters:			w: writer, buf/size: output buffer, flags: RECORD_TIMES or 0,
+**									g: game in its starting position
+** Returned value:		1 if started, 0 if buf cannot hold the header and the end
+**
+******************************************************************************/
+uint8_t record_begin( RecordWriter *w, uint8_t *buf, uint16_t size, uint8_t flags, const Game *g )
+{
+	uint8_t id;
+
+	w->buf = buf;
+	w->size = size;
+	w->len = 0;
+	w->moves = 0;
+	w->full = 0;
+	if( size < RECORD_HEADER + 2 )
+	{
+		w->size = 0;
+		return 0;
+	}
+	w->turn = g->activePlayer;
+	w->flags = (flags & RECORD_TIMES) | (w->turn ? RECORD_FIRST1 : 0);
+	buf[0] = RECORD_MAGIC0;
+	buf[1] = RECORD_MAGIC1;
+	buf[2] = RECORD_VERSION;
+	buf[3] = w->flags;
+	for( id = 0; id < 2; id++ )
+	{
+		w->square[id] = SQUARE(g->player[id].x, g->player[id].y);
+		buf[4 + id] = w->square[id];
+		buf[6 + id] = g->player[id].walls;
+	}
+	w->len = RECORD_HEADER;
+  return 1;
+}
+
+/******************************************************************************
+** Function name:		record_move
+**
+** Descriptions:		Appends a confirmed move of the player whose turn it is, in the
+**									form executeMove takes it: token move (destination one step or a
+**									jump away, or the token square itself), wall placement, or
+**									timeout (move 0, orientation 1).
+**
+** parameters:			w: writer, m: move, thinkMs: time taken by the player
+** Returned value:		1 if written, 0 if the move cannot be encoded or does not fit
+**
+******************************************************************************/
+uint8_t record_move( RecordWriter *w, Move m, uint32_t thinkMs )
+{
+	uint8_t code, step, target, square = w->square[w->turn];
+	uint8_t need = (w->flags & RECORD_TIMES) ? 2 : 1;
+
+	if( m.bits.move == 1 )
+	{
+		if( m.bits.x < 1 || m.bits.x > 6 || m.bits.y < 1 || m.bits.y > 6 || m.bits.orientation > 1 )
+		{
+			return 0;
+		}
+		code = RECORD_WALL + m.bits.orientation * 36 + (m.bits.x - 1) * 6 + (m.bits.y - 1);
+	}
+	else if( m.bits.orientation == 1 )
+	{
+		code = RECORD_TIMEOUT;
+	}
+	else
+	{
+		/* token: find the direction of the destination, a step or a jump away */
+		target = SQUARE(m.bits.x, m.bits.y);
+		code = (target == square) ? RECORD_PASS : RECORD_END;
+		for( step = 0; step < STEPS; step++ )
+		{
+			if( squareStep[square][step] == target ) code = RECORD_STEP + step;
+			else if( squareJump[square][step] == target ) code = RECORD_JUMP + step;
+		}
+		if( code == RECORD_END )
+		{
+			return 0;
+		}
+		square = target;
+	}
+
+	/* keep room for RECORD_END and the winner */
+	if( w->len + need + 2 > w->size )
+	{
+		w->full++;
+		return 0;
+	}
+	w->buf[w->len++] = code;
+	if( need == 2 )
+	{
+		thinkMs /= RECORD_THINK_MS;
+		w->buf[w->len++] = thinkMs > RECORD_THINK_MAX ? RECORD_THINK_MAX : thinkMs;
+	}
+	w->square[w->turn] = square;
+	w->turn ^= 1;
+	w->moves++;
+  return 1;
+}
+
+/******************************************************************************
+** Function name:		record_end
+**
+** Descriptions:		Closes the record with RECORD_END and the winner. Always fits.
+**
+** parameters:			w: writer, winner: player id or RECORD_NO_WINNER
+** Returned value:		None
+**
+******************************************************************************/
+void record_end( RecordWriter *w, uint8_t winner )
+{
+	if( w->len + 2 > w->size )
+	{
+		return;
+	}
+	w->buf[w->len++] = RECORD_END;
+	w->buf[w->len++] = winner;
+	w->size = w->len;                 /* nothing can be appended any more */
+  return;
+}
+
+/******************************************************************************
+** Function name:		record_open
+**
+** Descriptions:		Checks the header of a record and prepares to read its moves.
+**
+** parameters:			r: reader, buf/len: record
+** Returned value:		1 if the header is valid
+**
+******************************************************************************/
+uint8_t record_open( RecordReader *r, const uint8_t *buf, uint16_t len )
+{
+	r->buf = buf;
+	r->len = len;
+	r->pos = len;
+	r->winner = RECORD_NO_WINNER;
+	if( len < RECORD_HEADER || buf[0] != RECORD_MAGIC0 || buf[1] != RECORD_MAGIC1 ||
+	    buf[2] != RECORD_VERSION || buf[4] >= BOARD_SQUARES || buf[5] >= BOARD_SQUARES )
+	{
+		return 0;
+	}
+	r->flags = buf[3];
+	r->turn = (r->flags & RECORD_FIRST1) ? 1 : 0;
+	r->square[0] = buf[4];
+	r->square[1] = buf[5];
+	r->walls[0] = buf[6];
+	r->walls[1] = buf[7];
+	r->pos = RECORD_HEADER;
+  return 1;
+}
+
+/******************************************************************************
+** Function name:		record_next
+**
+** Descriptions:		Decodes the next move into the form record_move took it (playerID,
+**									move, orientation, x, y; a timeout and a pass keep the token
+**									square). The token squares and the walls left in the reader
+**									follow the game.
+**
+** parameters:			r: reader, m: decoded move, thinkMs: think time (0 without
+**									RECORD_TIMES), may be NULL
+** Returned value:		RECORD_READ_MOVE, RECORD_READ_END (winner set if the record is
+**									complete) or RECORD_READ_ERROR
+**
+******************************************************************************/
+uint8_t record_next( RecordReader *r, Move *m, uint32_t *thinkMs )
+{
+	uint8_t code, square, slot;
+	uint32_t think = 0;
+
+	if( r->pos >= r->len )
+	{
+		return RECORD_READ_END;
+	}
+	code = r->buf[r->pos++];
+	if( code == RECORD_END )
+	{
+		if( r->pos < r->len ) r->winner = r->buf[r->pos];
+		r->pos = r->len;
+		return RECORD_READ_END;
+	}
+	if( r->flags & RECORD_TIMES )
+	{
+		if( r->pos >= r->len )
+		{
+			return RECORD_READ_END;
+		}
+		think = r->buf[r->pos++] * RECORD_THINK_MS;
+	}
+
+	square = r->square[r->turn];
+	m->word32 = 0;
+	m->bits.playerID = r->turn;
+	if( code < RECORD_WALL_SLOTS )
+	{
+		slot = code - RECORD_WALL;
+		m->bits.move = 1;
+		m->bits.orientation = slot / 36;
+		m->bits.x = (slot % 36) / 6 + 1;
+		m->bits.y = slot % 6 + 1;
+		r->walls[r->turn]--;
+	}
+	else if( code < RECORD_TIMEOUT )
+	{
+		square = (code < RECORD_JUMP ? squareStep : squareJump)[square][code & 3];
+		if( square == NO_SQUARE )
+		{
+			r->pos = r->len;
+			return RECORD_READ_ERROR;
+		}
+		r->square[r->turn] = square;
+	}
+	else if( code == RECORD_TIMEOUT )
+	{
+		m->bits.orientation = 1;
+	}
+	else if( code != RECORD_PASS )
+	{
+		r->pos = r->len;
+		return RECORD_READ_ERROR;
+	}
+	if( code >= RECORD_STEP )
+	{
+		m->bits.x = squareRow[square];
+		m->bits.y = squareColumn[square];
+	}
+	r->turn ^= 1;
+	if( thinkMs ) *thinkMs = think;
+  return RECORD_READ_MOVE;
+}
+
+/******************************************************************************
+** Function name:		record_report
+**
+** Descriptions:		Prints the size of a record and its bytes in hex, 16 per line
+**									(Debug (printf) Viewer, UART)
+**
+** parameters:			w: writer
+** Returned value:		None
+**
+******************************************************************************/
+void record_report( const RecordWriter *w )
+{
+	uint16_t i;
+
+	printf("record: %u moves, %u bytes", w->moves, w->len);
+	if( w->full )
+	{
+		printf(", %u moves did not fit", w->full);
+	}
+	for( i = 0; i < w->len; i++ )
+	{
+		printf("%s%02X", (i % 16) ? " " : "\n", w->buf[i]);
+	}
+	printf("\n");
+  return;
+}
+
+/******************************************************************************
+**                            End Of File
+******************************************************************************/
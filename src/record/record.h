@@ -0,0 +1,87 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           record.h
+** Last modified Date:  2026-10-19
+** Last Version:        V1.00
+** Descriptions:        Compact game record: a short header, then one code byte per move (token step or
+**                      jump direction, wall slot, timeout) and optionally its think time
+** Correlated files:    lib_record.c, quoridor.c, boardtables.h
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#ifndef __RECORD_H
+#define __RECORD_H
+
+#include <stdint.h>
+#include "../quoridor.h"
+
+/* Header: 'Q' 'R', version, flags, square (SQUARE) of token 0 and token 1, walls of player 0 and 1 */
+#define RECORD_MAGIC0       'Q'
+#define RECORD_MAGIC1       'R'
+#define RECORD_VERSION      1
+#define RECORD_HEADER       8
+
+/* Header flags */
+#define RECORD_TIMES        0x01  /* a think time byte follows each move code   */
+#define RECORD_FIRST1       0x02  /* player 1 moves first                       */
+
+/* Move codes. The players alternate, from the one given by RECORD_FIRST1 */
+#define RECORD_WALL         0     /* 0..71: wall slot, orientation * 36 + (x-1) * 6 + (y-1) */
+#define RECORD_WALL_SLOTS   72
+#define RECORD_STEP         72    /* 72..75: token step, + STEP_*                 */
+#define RECORD_JUMP         76    /* 76..79: token jump over the other, + STEP_*  */
+#define RECORD_TIMEOUT      80    /* turn skipped                                 */
+#define RECORD_PASS         81    /* token confirmed on its own square            */
+#define RECORD_END          82    /* end of the game, followed by the winner      */
+#define RECORD_NO_WINNER    0xFF
+
+/* Think time: 100 ms units, saturated (the turn lasts 20 s) */
+#define RECORD_THINK_MS     100
+#define RECORD_THINK_MAX    255
+
+/* record_next results */
+#define RECORD_READ_END     0     /* RECORD_END read, or the record is truncated  */
+#define RECORD_READ_MOVE    1
+#define RECORD_READ_ERROR   2     /* unknown code, or a step/jump off the board   */
+
+/*******************************************************************************
+**   Writer of a record into a caller's buffer. Room for RECORD_END and the winner
+**   is always kept, so a full record still ends properly: full counts the moves
+**   that did not fit.
+********************************************************************************/
+typedef struct{
+	uint8_t *buf;
+	uint16_t size;
+	uint16_t len;
+	uint8_t flags;
+	uint8_t square[2];        /* SQUARE of each token */
+	uint8_t turn;             /* player of the next move */
+	uint16_t moves;
+	uint16_t full;
+}RecordWriter;
+
+/*******************************************************************************
+**   Reader of a record; winner is set when RECORD_END is read.
+********************************************************************************/
+typedef struct{
+	const uint8_t *buf;
+	uint16_t len;
+	uint16_t pos;
+	uint8_t flags;
+	uint8_t square[2];
+	uint8_t walls[2];
+	uint8_t turn;
+	uint8_t winner;
+}RecordReader;
+
+/* lib_record.c */
+extern uint8_t record_begin( RecordWriter *w, uint8_t *buf, uint16_t size, uint8_t flags, const Game *g );
+extern uint8_t record_move( RecordWriter *w, Move m, uint32_t thinkMs );
+extern void record_end( RecordWriter *w, uint8_t winner );
+extern uint8_t record_open( RecordReader *r, const uint8_t *buf, uint16_t len );
+extern uint8_t record_next( RecordReader *r, Move *m, uint32_t *thinkMs );
+extern void record_report( const RecordWriter *w );
+
+#endif /* end __RECORD_H */
+/*****************************************************************************
+**                            End Of File
+******************************************************************************/
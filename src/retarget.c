@@ -0,0 +1,32 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           retarget.c
+** Last modified Date:  2026-10-19
+** Last Version:        V1.00
+** Descriptions:        printf retargeting on the ITM stimulus port 0 (Debug (printf) Viewer)
+** Correlated files:
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#include <stdio.h>
+#include "LPC17xx.H"
+
+struct __FILE { int handle; };
+FILE __stdout;
+
+/******************************************************************************
+** Function name:		fputc
+**
+** Descriptions:		Sends one character of printf output to the ITM. When no
+**									debugger is attached the character is discarded.
+**
+** parameters:			character, stream
+** Returned value:		character written
+**
+******************************************************************************/
+int fputc(int ch, FILE *f) {
+	return (int)ITM_SendChar((uint32_t)ch);
+}
+
+/******************************************************************************
+**                            End Of File
+******************************************************************************/
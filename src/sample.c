@@ -6,39 +6,91 @@
 #include "joystick/joystick.h"
 #include "GLCD/GLCD.h"
 #include "quoridor.h"
+#include "event/event.h"
+#include "sched/sched.h"
+#include "latency/latency.h"
+#include "profile/profile.h"
+#include "clock/clock.h"
 
 #ifdef SIMULATOR
 extern uint8_t ScaleFlag; // <- ScaleFlag needs to visible in order for the emulator to find the symbol (can be placed also inside system_LPC17xx.h but since it is RO, it needs more work)
 #endif
+
+static uint8_t inputReady(void){ return event_pending(); }
+
+/* Task di input: un evento della coda per passo (logica di gioco e disegno della mossa) */
+static void inputTask(void){
+	Event e;
+	if( event_get(&e) ) {
+		handleEvent(e);
+	}
+}
+
+/* Task di telemetria: statistiche della partita terminata, latenza degli input, 
+   cicli delle funzioni pi costose e scheduler */
+static void telemetryTask(void){
+	reportGame();
+	latency_report();
+	profile_report();
+	clock_report();
+	sched_report();
+}
+
+/* Task del main loop in ordine di priorit, tempi in us. L'input (ridisegno della mossa, 
+   ricerca dei percorsi in checkTrap) gira a piena velocit, il resto al clock di attesa */
+static Task tasks[3] = {
+	/* name        ready          run            budget  deadline           clock       stats */
+	{ "input",     inputReady,    inputTask,     5000,   50000,             CLOCK_FULL, { 0 } },
+	{ "render",    hudPending,    drawHud,       2000,   100000,            CLOCK_IDLE, { 0 } },
+	{ "telemetry", reportPending, telemetryTask, 50000,  SCHED_NO_DEADLINE, CLOCK_IDLE, { 0 } }
+};
+
 /*----------------------------------------------------------------------------
 ** Function name:		main
 **
 ** Descriptions:		Main Program
-**                  Inizializza il sistema, i pulsanti, il joystick, il RIT (che viene anche abilitato), 
+**                  Inizializza il sistema, i pulsanti, il joystick, il RIT (avviato solo quando serve), 
 **                  il timer e lo schermo LCD. Dopodich viene inizializzata la grafica per il gioco Quoridor 
 **                  e si resta in attesa del comando dinizio.
+**                  Il main loop  uno scheduler cooperativo (sched_run): a ogni passo esegue il task 
+**                  pronto con priorit pi alta tra input (eventi inseriti dalle interrupt RIT e TIMER0, 
+**                  handleEvent), rendering (timer, drawHud) e telemetria (reportGame); quando nessun 
+**                  task  pronto il processore resta in sleep (wfi) al clock ridotto (clock_set).
 **
 **
  *----------------------------------------------------------------------------*/
 int main (void) {
+#ifdef SIMULATOR
+	uint32_t tLcd, tScreen;
+#endif
   	
 	SystemInit();  												/* System Initialization (i.e., PLL)  */
+	init_timebase();											/* TIMER1 1 us timebase (boot time, LCD delays) */
+	profile_init();												/* cycle counter of the profiling zones */
   BUTTON_init();												/* BUTTON Initialization              */
 	joystick_init();											/* Joystick Initialization            */
-	init_RIT(0x004C4B40);									/* RIT Initialization 50 msec       	*/
-	enable_RIT();													/* RIT enabled												*/
+	init_RIT(0x004C4B40);									/* RIT Initialization 50 msec (RIT_TICK_MS), started on demand */
 	init_timer(0, 0x17D7840); 						/*  1s * 25MHz = 0x17D7840 */
 	
 	LCD_Initialization();
-	LCD_Clear(Sand);
+#ifdef SIMULATOR
+	tLcd = read_timebase();
+#endif
 	
 	initQuoridor();
+#ifdef SIMULATOR
+	tScreen = read_timebase();
+	printf("boot: %u us (LCD init %u us, start screen %u us)\n", tScreen, tLcd, tScreen - tLcd);
+#ifdef LCD_TIMING_VERIFY
+	printf("LCD bus timing: %u violations\n", LCD_TimingViolations);
+#endif
+#endif
 	
 	LPC_SC->PCON |= 0x1;									/* power-down	mode										*/
 	LPC_SC->PCON &= ~(0x2);						
 		
-  while (1) {                           /* Loop forever                       */	
-		__ASM("wfi");
-  }
+	clock_init();													/* clock governor, full speed until idle */
+	sched_init(tasks, 3);
+	sched_run();													/* never returns                      */
 
 }
@@ -0,0 +1,158 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           lib_sched.c
+** Last modified Date:  2026-10-19
+** Last Version:        V1.00
+** Descriptions:        Cooperative static-priority scheduler: the highest priority ready task runs one
+**                      step to completion, the processor sleeps (wfi) when no task is ready
+** Correlated files:    sched.h, sample.c
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#include "lpc17xx.h"
+#include "sched.h"
+#include "../timer/timer.h"
+#include "../clock/clock.h"
+#include <stdio.h>
+#include <string.h>
+
+static Task *taskTable;
+static uint8_t taskCount = 0;
+
+/******************************************************************************
+** Function name:		sched_init
+**
+** Descriptions:		Installs the task table and clears its statistics
+**
+** parameters:			tasks: table in priority order (index 0 highest), count: entries
+** Returned value:		None
+**
+******************************************************************************/
+void sched_init( Task *tasks, uint8_t count )
+{
+	uint8_t i;
+
+	for( i = 0; i < count; i++ )
+	{
+		memset(&tasks[i].stats, 0, sizeof(tasks[i].stats));
+	}
+	taskTable = tasks;
+	taskCount = count;
+  return;
+}
+
+/******************************************************************************
+** Function name:		sched_step
+**
+** Descriptions:		Polls every task, timestamping the ones that just became ready,
+**									then runs one step of the highest priority ready task, at its
+**									clock level (clock_set), and records
+**									its run time (budget) and its ready-to-done time (deadline).
+**
+** parameters:			None
+** Returned value:		1 if a task ran, 0 if none was ready
+**
+******************************************************************************/
+uint8_t sched_step( void )
+{
+	Task *t = 0;
+	uint32_t now = read_timebase();
+	uint32_t start, run, latency;
+	uint8_t i;
+
+	for( i = 0; i < taskCount; i++ )
+	{
+		if( taskTable[i].ready() )
+		{
+			if( taskTable[i].stats.waiting == 0 )
+			{
+				taskTable[i].stats.waiting = 1;
+				taskTable[i].stats.released = now;
+			}
+			if( t == 0 )
+			{
+				t = &taskTable[i];
+			}
+		}
+	}
+	if( t == 0 )
+	{
+		return 0;
+	}
+
+	clock_set(t->clock);
+	start = read_timebase();
+	t->run();
+	now = read_timebase();
+	run = now - start;
+	latency = now - t->stats.released;
+	t->stats.waiting = 0;
+
+	t->stats.runs++;
+	if( run > t->stats.worstRun ) t->stats.worstRun = run;
+	if( latency > t->stats.worstLatency ) t->stats.worstLatency = latency;
+	if( run > t->budget ) t->stats.overruns++;
+	if( t->deadline != SCHED_NO_DEADLINE && latency > t->deadline ) t->stats.misses++;
+	return 1;
+}
+
+/******************************************************************************
+** Function name:		sched_run
+**
+** Descriptions:		Main loop: runs ready tasks until none is left, then sleeps at
+**									the idle clock. The ready check is repeated with the interrupts masked, so an
+**									ISR that makes a task ready after it still wakes the wfi.
+**
+** parameters:			None
+** Returned value:		None (never returns)
+**
+******************************************************************************/
+void sched_run( void )
+{
+	uint8_t i, ready;
+
+	while( 1 )
+	{
+		while( sched_step() );
+
+		clock_set(CLOCK_IDLE);
+		__disable_irq();
+		ready = 0;
+		for( i = 0; i < taskCount; i++ )
+		{
+			ready |= taskTable[i].ready();
+		}
+		if( !ready )
+		{
+			__ASM("wfi");
+		}
+		__enable_irq();
+	}
+}
+
+/******************************************************************************
+** Function name:		sched_report
+**
+** Descriptions:		Prints the task statistics (Debug (printf) Viewer)
+**
+** parameters:			None
+** Returned value:		None
+**
+******************************************************************************/
+void sched_report( void )
+{
+	uint8_t i;
+
+	printf("%-10s %6s %8s %8s %6s %8s %8s %6s\n",
+	       "task", "runs", "budget", "worst", "over", "deadline", "worst", "miss");
+	for( i = 0; i < taskCount; i++ )
+	{
+		printf("%-10s %6u %8u %8u %6u %8u %8u %6u\n", taskTable[i].name, taskTable[i].stats.runs,
+		       taskTable[i].budget, taskTable[i].stats.worstRun, taskTable[i].stats.overruns,
+		       taskTable[i].deadline, taskTable[i].stats.worstLatency, taskTable[i].stats.misses);
+	}
+  return;
+}
+
+/******************************************************************************
+**                            End Of File
+******************************************************************************/
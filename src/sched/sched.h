@@ -0,0 +1,54 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           sched.h
+** Last modified Date:  2026-10-19
+** Last Version:        V1.00
+** Descriptions:        Cooperative run-to-completion scheduler of the main loop: static priorities,
+**                      per-task budget, deadline and clock level, overruns recorded in the task table
+** Correlated files:    lib_sched.c, sample.c
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#ifndef __SCHED_H
+#define __SCHED_H
+
+#include <stdint.h>
+
+#define SCHED_NO_DEADLINE   0     /* deadline of a task that may wait indefinitely */
+
+/*******************************************************************************
+**   One task of the main loop. The table passed to sched_init is in priority
+**   order (index 0 first). ready() is polled, run() does one bounded step of
+**   work and returns: it is never preempted by another task, only by the ISRs.
+**   Each step runs at the clock level of its task, the idle wait at CLOCK_IDLE.
+**   Times are in microseconds of the TIMER1 timebase.
+********************************************************************************/
+typedef struct{
+	uint32_t runs;
+	uint32_t overruns;            /* runs longer than budget            */
+	uint32_t misses;              /* steps done after the deadline      */
+	uint32_t worstRun;
+	uint32_t worstLatency;        /* ready to done                      */
+	uint32_t released;            /* timebase when first seen ready     */
+	uint8_t waiting;
+}TaskStats;
+
+typedef struct{
+	const char *name;
+	uint8_t (*ready)( void );     /* 1 when the task has work           */
+	void (*run)( void );          /* one step, runs to completion       */
+	uint32_t budget;              /* longest accepted run               */
+	uint32_t deadline;            /* longest accepted ready-to-done time */
+	uint8_t clock;                /* CLOCK_* level of the steps         */
+	TaskStats stats;              /* Watch window, sched_report; { 0 } in the table */
+}Task;
+
+/* lib_sched.c */
+extern void sched_init( Task *tasks, uint8_t count );
+extern uint8_t sched_step( void );
+extern void sched_run( void );
+extern void sched_report( void );
+
+#endif /* end __SCHED_H */
+/*****************************************************************************
+**                            End Of File
+******************************************************************************/
@@ -0,0 +1,556 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           startscreen.c
+** Descriptions:        GENERATED by tools/startscreen.py, do not edit. Start screen of the game,
+**                      run-length encoded for LCD_DrawRLE (4279 runs, 8558 bytes)
+** Correlated files:    startscreen.h, quoridor.c
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#include "GLCD/GLCD.h"
+#include "startscreen.h"
+
+const uint16_t startScreenPalette[START_SCREEN_COLORS] = {
+	Sand, Black, Red, White
+};
+
+const uint16_t startScreenRuns[START_SCREEN_RUNS] = {
+	LCD_RLE_RUN(0,2410),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,13),
+	LCD_RLE_RUN(2,1),LCD_RLE_RUN(1,12),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,9),
+	LCD_RLE_RUN(2,9),LCD_RLE_RUN(1,8),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,8),
+	LCD_RLE_RUN(2,11),LCD_RLE_RUN(1,7),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,7),
+	LCD_RLE_RUN(2,13),LCD_RLE_RUN(1,6),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,6),
+	LCD_RLE_RUN(2,15),LCD_RLE_RUN(1,5),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,5),
+	LCD_RLE_RUN(2,17),LCD_RLE_RUN(1,4),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,5),
+	LCD_RLE_RUN(2,17),LCD_RLE_RUN(1,4),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,5),
+	LCD_RLE_RUN(2,17),LCD_RLE_RUN(1,4),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,5),
+	LCD_RLE_RUN(2,17),LCD_RLE_RUN(1,4),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,4),
+	LCD_RLE_RUN(2,19),LCD_RLE_RUN(1,3),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,5),
+	LCD_RLE_RUN(2,17),LCD_RLE_RUN(1,4),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,5),
+	LCD_RLE_RUN(2,17),LCD_RLE_RUN(1,4),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,5),
+	LCD_RLE_RUN(2,17),LCD_RLE_RUN(1,4),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,5),
+	LCD_RLE_RUN(2,17),LCD_RLE_RUN(1,4),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,6),
+	LCD_RLE_RUN(2,15),LCD_RLE_RUN(1,5),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,7),
+	LCD_RLE_RUN(2,13),LCD_RLE_RUN(1,6),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,8),
+	LCD_RLE_RUN(2,11),LCD_RLE_RUN(1,7),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,9),
+	LCD_RLE_RUN(2,9),LCD_RLE_RUN(1,8),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,13),
+	LCD_RLE_RUN(2,1),LCD_RLE_RUN(1,12),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,1462),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,1462),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,1462),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,1462),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,1462),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,1462),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,13),LCD_RLE_RUN(3,1),LCD_RLE_RUN(1,12),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,9),LCD_RLE_RUN(3,9),LCD_RLE_RUN(1,8),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,8),LCD_RLE_RUN(3,11),LCD_RLE_RUN(1,7),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,7),LCD_RLE_RUN(3,13),LCD_RLE_RUN(1,6),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,6),LCD_RLE_RUN(3,15),LCD_RLE_RUN(1,5),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,5),LCD_RLE_RUN(3,17),LCD_RLE_RUN(1,4),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,5),LCD_RLE_RUN(3,17),LCD_RLE_RUN(1,4),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,5),LCD_RLE_RUN(3,17),LCD_RLE_RUN(1,4),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,5),LCD_RLE_RUN(3,17),LCD_RLE_RUN(1,4),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,4),LCD_RLE_RUN(3,19),LCD_RLE_RUN(1,3),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,5),LCD_RLE_RUN(3,17),LCD_RLE_RUN(1,4),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,5),LCD_RLE_RUN(3,17),LCD_RLE_RUN(1,4),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,5),LCD_RLE_RUN(3,17),LCD_RLE_RUN(1,4),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,5),LCD_RLE_RUN(3,17),LCD_RLE_RUN(1,4),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,6),LCD_RLE_RUN(3,15),LCD_RLE_RUN(1,5),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,7),LCD_RLE_RUN(3,13),LCD_RLE_RUN(1,6),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,8),LCD_RLE_RUN(3,11),LCD_RLE_RUN(1,7),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,9),LCD_RLE_RUN(3,9),LCD_RLE_RUN(1,8),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,13),LCD_RLE_RUN(3,1),LCD_RLE_RUN(1,12),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,26),
+	LCD_RLE_RUN(0,4096),LCD_RLE_RUN(0,4096),LCD_RLE_RUN(0,470),LCD_RLE_RUN(1,70),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,70),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,70),
+	LCD_RLE_RUN(0,18),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,18),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,18),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,18),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,18),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,18),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(3,5),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,47),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,12),LCD_RLE_RUN(1,7),LCD_RLE_RUN(0,49),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(2,5),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(2,1),LCD_RLE_RUN(0,46),LCD_RLE_RUN(2,2),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,18),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,4),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,5),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,45),LCD_RLE_RUN(3,3),
+	LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,15),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,7),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,44),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(2,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(2,1),
+	LCD_RLE_RUN(0,5),LCD_RLE_RUN(2,1),LCD_RLE_RUN(0,45),LCD_RLE_RUN(2,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(2,1),LCD_RLE_RUN(0,3),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,18),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,5),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(3,1),
+	LCD_RLE_RUN(0,47),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,15),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,7),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,44),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(2,1),
+	LCD_RLE_RUN(0,5),LCD_RLE_RUN(2,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(2,1),LCD_RLE_RUN(0,44),LCD_RLE_RUN(2,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(2,1),
+	LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,18),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,5),LCD_RLE_RUN(3,1),
+	LCD_RLE_RUN(0,4),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,47),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,15),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,52),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(2,1),
+	LCD_RLE_RUN(0,5),LCD_RLE_RUN(2,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(2,1),LCD_RLE_RUN(0,44),LCD_RLE_RUN(2,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(2,1),
+	LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,18),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,5),LCD_RLE_RUN(3,1),
+	LCD_RLE_RUN(0,4),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,47),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,15),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,52),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(2,1),
+	LCD_RLE_RUN(0,5),LCD_RLE_RUN(2,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(2,1),LCD_RLE_RUN(0,49),LCD_RLE_RUN(2,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,18),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,5),LCD_RLE_RUN(3,1),
+	LCD_RLE_RUN(0,5),LCD_RLE_RUN(3,4),LCD_RLE_RUN(0,3),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,5),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,3),LCD_RLE_RUN(3,3),
+	LCD_RLE_RUN(0,5),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,1),LCD_RLE_RUN(3,3),LCD_RLE_RUN(0,12),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,15),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,7),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,1),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,1),LCD_RLE_RUN(1,2),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,3),LCD_RLE_RUN(0,5),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,1),LCD_RLE_RUN(1,3),LCD_RLE_RUN(0,17),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(2,1),
+	LCD_RLE_RUN(0,4),LCD_RLE_RUN(2,1),LCD_RLE_RUN(0,5),LCD_RLE_RUN(2,1),LCD_RLE_RUN(0,5),LCD_RLE_RUN(2,4),LCD_RLE_RUN(0,3),LCD_RLE_RUN(2,1),
+	LCD_RLE_RUN(0,5),LCD_RLE_RUN(2,1),LCD_RLE_RUN(0,3),LCD_RLE_RUN(2,3),LCD_RLE_RUN(0,5),LCD_RLE_RUN(2,1),LCD_RLE_RUN(0,1),LCD_RLE_RUN(2,3),
+	LCD_RLE_RUN(0,13),LCD_RLE_RUN(2,1),LCD_RLE_RUN(0,3),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,18),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(3,5),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(3,1),
+	LCD_RLE_RUN(0,5),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,3),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(3,2),
+	LCD_RLE_RUN(0,15),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,15),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,7),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,2),LCD_RLE_RUN(0,1),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,3),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,2),LCD_RLE_RUN(0,20),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(2,5),LCD_RLE_RUN(0,6),LCD_RLE_RUN(2,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(2,1),
+	LCD_RLE_RUN(0,4),LCD_RLE_RUN(2,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(2,1),LCD_RLE_RUN(0,5),LCD_RLE_RUN(2,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(2,1),
+	LCD_RLE_RUN(0,3),LCD_RLE_RUN(2,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(2,2),LCD_RLE_RUN(0,16),LCD_RLE_RUN(2,1),LCD_RLE_RUN(0,3),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,18),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,10),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,9),LCD_RLE_RUN(3,1),
+	LCD_RLE_RUN(0,3),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,3),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,5),LCD_RLE_RUN(3,1),
+	LCD_RLE_RUN(0,3),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,16),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,15),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,7),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,1),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,5),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,3),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,21),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(2,1),LCD_RLE_RUN(0,10),LCD_RLE_RUN(2,1),
+	LCD_RLE_RUN(0,9),LCD_RLE_RUN(2,1),LCD_RLE_RUN(0,3),LCD_RLE_RUN(2,1),LCD_RLE_RUN(0,3),LCD_RLE_RUN(2,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(2,1),
+	LCD_RLE_RUN(0,5),LCD_RLE_RUN(2,1),LCD_RLE_RUN(0,3),LCD_RLE_RUN(2,1),LCD_RLE_RUN(0,16),LCD_RLE_RUN(2,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,18),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,10),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(3,4),
+	LCD_RLE_RUN(0,3),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,3),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(3,7),LCD_RLE_RUN(0,3),LCD_RLE_RUN(3,1),
+	LCD_RLE_RUN(0,16),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,15),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,7),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,1),LCD_RLE_RUN(1,7),LCD_RLE_RUN(0,3),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,21),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,4),LCD_RLE_RUN(2,1),LCD_RLE_RUN(0,10),LCD_RLE_RUN(2,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(2,4),LCD_RLE_RUN(0,3),LCD_RLE_RUN(2,1),
+	LCD_RLE_RUN(0,3),LCD_RLE_RUN(2,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(2,7),LCD_RLE_RUN(0,3),LCD_RLE_RUN(2,1),LCD_RLE_RUN(0,15),LCD_RLE_RUN(2,1),
+	LCD_RLE_RUN(0,5),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,18),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,10),LCD_RLE_RUN(3,1),
+	LCD_RLE_RUN(0,5),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,3),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,1),LCD_RLE_RUN(3,1),
+	LCD_RLE_RUN(0,3),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,9),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,16),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,15),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,7),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,1),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,9),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,21),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(2,1),LCD_RLE_RUN(0,10),LCD_RLE_RUN(2,1),
+	LCD_RLE_RUN(0,5),LCD_RLE_RUN(2,1),LCD_RLE_RUN(0,3),LCD_RLE_RUN(2,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(2,1),LCD_RLE_RUN(0,1),LCD_RLE_RUN(2,1),
+	LCD_RLE_RUN(0,3),LCD_RLE_RUN(2,1),LCD_RLE_RUN(0,9),LCD_RLE_RUN(2,1),LCD_RLE_RUN(0,15),LCD_RLE_RUN(2,1),LCD_RLE_RUN(0,5),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,18),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,10),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(3,1),
+	LCD_RLE_RUN(0,4),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,1),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,3),LCD_RLE_RUN(3,1),
+	LCD_RLE_RUN(0,9),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,16),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,15),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,7),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,1),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,9),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,21),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(2,1),LCD_RLE_RUN(0,10),LCD_RLE_RUN(2,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(2,1),
+	LCD_RLE_RUN(0,4),LCD_RLE_RUN(2,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(2,1),LCD_RLE_RUN(0,1),LCD_RLE_RUN(2,1),LCD_RLE_RUN(0,3),LCD_RLE_RUN(2,1),
+	LCD_RLE_RUN(0,9),LCD_RLE_RUN(2,1),LCD_RLE_RUN(0,14),LCD_RLE_RUN(2,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,18),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,4),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,10),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,3),LCD_RLE_RUN(3,2),
+	LCD_RLE_RUN(0,5),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,5),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,3),LCD_RLE_RUN(3,1),
+	LCD_RLE_RUN(0,16),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,15),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,7),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,3),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,21),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(2,1),LCD_RLE_RUN(0,10),LCD_RLE_RUN(2,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(2,1),
+	LCD_RLE_RUN(0,3),LCD_RLE_RUN(2,2),LCD_RLE_RUN(0,5),LCD_RLE_RUN(2,1),LCD_RLE_RUN(0,5),LCD_RLE_RUN(2,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(2,1),
+	LCD_RLE_RUN(0,3),LCD_RLE_RUN(2,1),LCD_RLE_RUN(0,13),LCD_RLE_RUN(2,1),LCD_RLE_RUN(0,7),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,18),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,4),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,10),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,5),LCD_RLE_RUN(3,3),LCD_RLE_RUN(0,1),LCD_RLE_RUN(3,2),
+	LCD_RLE_RUN(0,3),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,7),LCD_RLE_RUN(3,4),LCD_RLE_RUN(0,4),LCD_RLE_RUN(3,1),LCD_RLE_RUN(0,16),LCD_RLE_RUN(3,1),
+	LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,15),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,7),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,3),LCD_RLE_RUN(1,4),
+	LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,21),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(2,1),
+	LCD_RLE_RUN(0,10),LCD_RLE_RUN(2,1),LCD_RLE_RUN(0,5),LCD_RLE_RUN(2,3),LCD_RLE_RUN(0,1),LCD_RLE_RUN(2,2),LCD_RLE_RUN(0,3),LCD_RLE_RUN(2,1),
+	LCD_RLE_RUN(0,7),LCD_RLE_RUN(2,4),LCD_RLE_RUN(0,4),LCD_RLE_RUN(2,1),LCD_RLE_RUN(0,13),LCD_RLE_RUN(2,6),LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,18),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,28),LCD_RLE_RUN(3,2),LCD_RLE_RUN(0,38),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,28),LCD_RLE_RUN(2,2),LCD_RLE_RUN(0,38),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,18),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,18),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,18),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,18),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,18),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,18),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,18),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,12),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,7),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,30),LCD_RLE_RUN(1,2),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,2),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,2),LCD_RLE_RUN(0,36),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,12),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,7),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,30),LCD_RLE_RUN(1,2),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,18),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,12),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,7),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,29),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,3),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,21),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,35),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,12),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,7),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,29),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,3),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,18),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,12),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,7),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,28),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,20),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,34),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,12),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,7),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,28),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,18),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,12),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,7),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,28),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,20),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,34),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,12),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,7),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,28),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,18),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,1),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,1),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,1),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,12),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,7),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,14),LCD_RLE_RUN(1,2),
+	LCD_RLE_RUN(0,12),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,25),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,34),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,1),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,1),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,1),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,12),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,7),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,14),LCD_RLE_RUN(1,2),
+	LCD_RLE_RUN(0,12),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,18),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,1),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,1),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,1),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,4),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,7),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,5),LCD_RLE_RUN(1,5),
+	LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,2),LCD_RLE_RUN(0,13),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,3),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,24),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,3),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,3),LCD_RLE_RUN(1,5),LCD_RLE_RUN(0,26),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,1),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,1),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,1),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,4),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,7),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,5),LCD_RLE_RUN(1,5),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,2),
+	LCD_RLE_RUN(0,13),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,3),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,18),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,1),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,1),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,1),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,1),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,5),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,7),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,5),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,19),LCD_RLE_RUN(1,2),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,24),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,3),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,5),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,25),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,1),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,1),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,1),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,1),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,5),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,7),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,5),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,19),LCD_RLE_RUN(1,2),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,18),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,1),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,1),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,1),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,5),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,7),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,24),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,3),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,23),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,31),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,1),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,1),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,1),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,5),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,7),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,24),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,3),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,18),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,5),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,3),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,4),LCD_RLE_RUN(0,5),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,7),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,5),LCD_RLE_RUN(1,2),LCD_RLE_RUN(0,21),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,5),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,3),LCD_RLE_RUN(1,2),LCD_RLE_RUN(0,29),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,5),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,3),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,4),LCD_RLE_RUN(0,5),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,7),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,5),LCD_RLE_RUN(1,2),LCD_RLE_RUN(0,21),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,18),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,5),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,3),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,3),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,3),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,5),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,7),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,7),LCD_RLE_RUN(1,3),
+	LCD_RLE_RUN(0,18),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,22),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,5),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,5),LCD_RLE_RUN(1,3),
+	LCD_RLE_RUN(0,26),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,5),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,3),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,3),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,3),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,5),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,7),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,7),LCD_RLE_RUN(1,3),LCD_RLE_RUN(0,18),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,18),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,5),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,3),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,5),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,7),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,10),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,3),LCD_RLE_RUN(1,2),LCD_RLE_RUN(0,12),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,21),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,8),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,25),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,5),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,3),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,5),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,7),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,10),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,3),LCD_RLE_RUN(1,2),LCD_RLE_RUN(0,12),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,18),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,5),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,3),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,3),LCD_RLE_RUN(1,2),LCD_RLE_RUN(0,5),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,7),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,5),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,3),LCD_RLE_RUN(1,2),
+	LCD_RLE_RUN(0,13),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,3),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,20),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,8),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,3),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,5),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,25),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,5),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,3),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,3),LCD_RLE_RUN(1,2),LCD_RLE_RUN(0,5),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,7),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,5),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,3),LCD_RLE_RUN(1,2),
+	LCD_RLE_RUN(0,13),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,2),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,3),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,18),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,5),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,3),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,3),LCD_RLE_RUN(1,3),LCD_RLE_RUN(0,1),LCD_RLE_RUN(1,2),
+	LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,7),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,5),LCD_RLE_RUN(1,5),LCD_RLE_RUN(0,20),LCD_RLE_RUN(1,2),
+	LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,20),LCD_RLE_RUN(1,6),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,2),
+	LCD_RLE_RUN(0,5),LCD_RLE_RUN(1,5),LCD_RLE_RUN(0,26),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,5),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,3),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,3),LCD_RLE_RUN(1,3),LCD_RLE_RUN(0,1),LCD_RLE_RUN(1,2),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,7),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,5),LCD_RLE_RUN(1,5),LCD_RLE_RUN(0,20),LCD_RLE_RUN(1,2),LCD_RLE_RUN(0,4),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,18),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,18),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,18),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,18),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,18),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,18),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,18),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,18),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,18),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,18),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,1),LCD_RLE_RUN(0,68),LCD_RLE_RUN(1,1),
+	LCD_RLE_RUN(0,18),LCD_RLE_RUN(1,70),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,70),LCD_RLE_RUN(0,6),LCD_RLE_RUN(1,70),LCD_RLE_RUN(0,1448)
+};
+
+/******************************************************************************
+**                            End Of File
+******************************************************************************/
@@ -0,0 +1,28 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           startscreen.h
+** Descriptions:        GENERATED by tools/startscreen.py, do not edit. Start screen of the game,
+**                      run-length encoded for LCD_DrawRLE (4279 runs, 8558 bytes)
+** Correlated files:    startscreen.c, quoridor.c
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#ifndef __STARTSCREEN_H
+#define __STARTSCREEN_H
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Private define ------------------------------------------------------------*/
+#define START_SCREEN_WIDTH    240
+#define START_SCREEN_HEIGHT   320
+#define START_SCREEN_COLORS   4
+#define START_SCREEN_RUNS     4279
+
+/* Private variables ---------------------------------------------------------*/
+extern const uint16_t startScreenPalette[START_SCREEN_COLORS];
+extern const uint16_t startScreenRuns[START_SCREEN_RUNS];
+
+#endif /* end __STARTSCREEN_H */
+/*****************************************************************************
+**                            End Of File
+******************************************************************************/
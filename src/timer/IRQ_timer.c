@@ -9,17 +9,14 @@
 *********************************************************************************************************/
 #include "lpc17xx.h"
 #include "timer.h"
-#include "../GLCD/GLCD.h"
-#include "../quoridor.h"
+#include "../event/event.h"
 
-extern int timeQuoridor;
 /******************************************************************************
 ** Function name:		Timer0_IRQHandler
 **
 ** Descriptions:		Timer/Counter 0 interrupt handler
-**                  Aggiorna la sezione della grafica relativa al timer e quando 
-**									scattano i 20 secondi esegue la mossa di tipo Move che rappresenta 
-**									il timeout del turno. Questa viene gestita da executeMove.
+**                  Inserisce nella coda un evento EVENT_TICK per ogni secondo del turno: 
+**									aggiornamento del timer e timeout sono gestiti dal main loop (handleEvent).
 **
 ** parameters:			None
 ** Returned value:		None
@@ -28,17 +25,7 @@ extern int timeQuoridor;
 
 void TIMER0_IRQHandler (void)
 {
-	char t[6] = " ";
-	if(timeQuoridor>0)timeQuoridor--;
-	sprintf(t,"  %02ds",timeQuoridor);
-	drawRectangleWithText(1, t, 1, Black);
-	
-	if(timeQuoridor==0){
-		Move m;
-		m.word32 = 0;
-		m.bits.orientation=1;
-		executeMove(m, true);
-	}
+	event_put(EVENT_TICK, 0);
   LPC_TIM0->IR = 1;			/* clear interrupt flag */
   return;
 }
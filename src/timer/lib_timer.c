@@ -9,7 +9,10 @@
 *********************************************************************************************************/
 #include "lpc17xx.h"
 #include "timer.h"
-volatile int timeQuoridor=21;
+extern uint32_t SystemFrequency;			/* core clock, system_LPC17xx.c */
+
+static RescaleCarry tim0Carry = { 0, 1 };		/* TIMER0 count             */
+static RescaleCarry tim1Carry = { 0, 1 };		/* TIMER1 prescale count    */
 /******************************************************************************
 ** Function name:		enable_timer
 **
@@ -156,6 +159,136 @@ uint32_t init_timer ( uint8_t timer_num, uint32_t TimerInterval )
   return (0);
 }
 
+/******************************************************************************
+** Function name:		timebase_prescaler
+**
+** Descriptions:		TIMER1 prescaler giving a 1 us tick at the current SystemFrequency
+**									and TIMER1 peripheral clock divider
+**
+** parameters:			None
+** Returned value:		PR value
+**
+******************************************************************************/
+static uint32_t timebase_prescaler( void )
+{
+  static const uint8_t pclkDiv[4] = { 4, 1, 2, 8 };   /* PCLKSEL0 PCLK_TIMER1 (bits 5:4) */
+
+  return SystemFrequency / pclkDiv[(LPC_SC->PCLKSEL0 >> 4) & 0x03] / 1000000 - 1;
+}
+
+/******************************************************************************
+** Function name:		init_timebase
+**
+** Descriptions:		Starts TIMER1 as a free-running 1 MHz timebase (one tick per
+**									microsecond, no interrupt), for delay_us and for timing
+**									measurements. The prescaler follows SystemFrequency and the
+**									TIMER1 peripheral clock divider, so the tick stays 1 us at any
+**									core clock.
+**
+** parameters:			None
+** Returned value:		None
+**
+******************************************************************************/
+void init_timebase( void )
+{
+  LPC_SC->PCONP |= (1 << 2);						/* PCTIM1 */
+
+  LPC_TIM1->TCR = 0x02;							/* stop and reset */
+  LPC_TIM1->CTCR = 0;							/* timer mode, PCLK */
+  LPC_TIM1->PR = timebase_prescaler();
+  LPC_TIM1->MCR = 0;							/* no match, never stops */
+  LPC_TIM1->TCR = 0x01;
+  return;
+}
+
+/******************************************************************************
+** Function name:		read_timebase
+**
+** Descriptions:		Current value of the timebase
+**
+** parameters:			None
+** Returned value:		microseconds since init_timebase (wraps after ~71 minutes)
+**
+******************************************************************************/
+uint32_t read_timebase( void )
+{
+  return LPC_TIM1->TC;
+}
+
+/******************************************************************************
+** Function name:		delay_us
+**
+** Descriptions:		Busy-waits at least us microseconds on the timebase (started
+**									here if it is not running yet)
+**
+** parameters:			microseconds
+** Returned value:		None
+**
+******************************************************************************/
+void delay_us( uint32_t us )
+{
+  uint32_t start;
+
+  if ( (LPC_TIM1->TCR & 0x01) == 0 )
+  {
+	init_timebase();
+  }
+  start = LPC_TIM1->TC;
+  while ( LPC_TIM1->TC - start <= us );
+  return;
+}
+
+/******************************************************************************
+** Function name:		rescale_count
+**
+** Descriptions:		Scales a running count by mul/div. The fraction of a tick lost
+**									to the division is kept in carry and added back at the next
+**									rescale of the same count: a switch down and back up gives the
+**									count it would have had, so the switches do not add up to a
+**									drift. Exact when the next rescale is the inverse one (two
+**									clock levels), otherwise the error stays below one tick.
+**
+** parameters:			count, mul, div: new/old clock, reduced, carry: of this count
+** Returned value:		scaled count
+**
+******************************************************************************/
+uint32_t rescale_count( uint32_t count, uint32_t mul, uint32_t div, RescaleCarry *carry )
+{
+  uint32_t num = count * mul + carry->rem * mul / carry->div;
+
+  carry->rem = num % div;
+  carry->div = div;
+  return num / div;
+}
+
+/******************************************************************************
+** Function name:		rescale_timers
+**
+** Descriptions:		The core clock changed by mul/div (SystemFrequency already
+**									updated, interrupts masked): scales match value and count of
+**									TIMER0, so that its period is kept, and recomputes the timebase
+**									prescaler, scaling the prescale count within the current us.
+**									The truncated fractions are carried (rescale_count). TIMER0
+**									has no prescaler (PR 0).
+**
+** parameters:			mul, div: new/old core clock, reduced
+** Returned value:		None
+**
+******************************************************************************/
+void rescale_timers( uint32_t mul, uint32_t div )
+{
+  uint32_t run = LPC_TIM0->TCR;
+
+  LPC_TIM0->TCR = 0;
+  LPC_TIM0->MR0 = LPC_TIM0->MR0 * mul / div;
+  LPC_TIM0->TC = rescale_count(LPC_TIM0->TC, mul, div, &tim0Carry);
+  LPC_TIM0->TCR = run;
+
+  LPC_TIM1->PR = timebase_prescaler();
+  LPC_TIM1->PC = rescale_count(LPC_TIM1->PC, mul, div, &tim1Carry);
+  return;
+}
+
 /******************************************************************************
 **                            End Of File
 ******************************************************************************/
@@ -15,6 +15,17 @@ extern uint32_t init_timer( uint8_t timer_num, uint32_t timerInterval );
 extern void enable_timer( uint8_t timer_num );
 extern void disable_timer( uint8_t timer_num );
 extern void reset_timer( uint8_t timer_num );
+/* timebase on TIMER1 (1 tick = 1 us): TIMER1 is not available to init_timer */
+extern void init_timebase( void );
+extern uint32_t read_timebase( void );
+extern void delay_us( uint32_t us );
+/* clock governor (clock/lib_clock.c) */
+typedef struct{
+	uint32_t rem;             /* fraction of a tick dropped by the last rescale, */
+	uint32_t div;             /* in 1/div of a tick                              */
+}RescaleCarry;
+extern uint32_t rescale_count( uint32_t count, uint32_t mul, uint32_t div, RescaleCarry *carry );
+extern void rescale_timers( uint32_t mul, uint32_t div );
 /* IRQ_timer.c */
 extern void TIMER0_IRQHandler (void);
 extern void TIMER1_IRQHandler (void);
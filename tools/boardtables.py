@@ -0,0 +1,148 @@
+#!/usr/bin/env python3
+"""Board lookup tables generator.
+
+Writes the constant tables the rules of quoridor.c use to step between the
+squares of the board, so that updatePlayerState, search and checkTrap (and
+the move generator of the benchmark) need no bounds checks:
+
+    boardtables.h   square indexing, step codes and declarations
+    boardtables.c   the tables
+
+Squares are numbered row by row (index = x * BOARD_SIZE + y, x the row as in
+the rest of the game). For every square the tables give its row and column,
+the square one step away in each direction, the square two steps away (the
+landing square of a jump) and the steps that leave the board. A wall slot
+closes four steps, two on each side of the wall: wallEdgeSquare and
+wallEdgeStep give them relative to the square of the slot, following the
+wallH/wallV convention of insertWall (wallV: left side of the square,
+wallH: top side).
+
+The board size is read from the BOARD_SIZE #define of quoridor.c. Rerun the
+script after changing it (quoridor.c checks BOARD_SQUARES at compile time):
+
+    python ../tools/boardtables.py            (from src)
+    python tools/boardtables.py --src src
+"""
+
+import argparse
+import os
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from startscreen import evaluate, header, parse_defines, read, write  # noqa: E402
+
+# Step codes, in the order of the Direction fields (and of the search)
+STEPS = [('UP', -1, 0), ('DOWN', 1, 0), ('LEFT', 0, -1), ('RIGHT', 0, 1)]
+NO_SQUARE = 0xFF
+
+# Steps closed by a wall slot [x, y], per orientation: (dx, dy, step) of the
+# squares whose side the wall covers. Vertical (0): wallV of [x][y] and
+# [x-1][y], the left side of those squares and the right side of the squares
+# on their left. Horizontal (1): wallH of [x][y] and [x][y-1], the top side
+# of those squares and the bottom side of the squares above.
+WALL_EDGES = [
+    [(0, 0, 'LEFT'), (-1, 0, 'LEFT'), (0, -1, 'RIGHT'), (-1, -1, 'RIGHT')],
+    [(0, 0, 'UP'), (0, -1, 'UP'), (-1, 0, 'DOWN'), (-1, -1, 'DOWN')],
+]
+
+
+def tables(size):
+    def index(x, y):
+        return x * size + y if 0 <= x < size and 0 <= y < size else NO_SQUARE
+
+    squares = range(size * size)
+    row = [s // size for s in squares]
+    column = [s % size for s in squares]
+    step = [[index(row[s] + dx, column[s] + dy) for _, dx, dy in STEPS] for s in squares]
+    jump = [[index(row[s] + 2 * dx, column[s] + 2 * dy) for _, dx, dy in STEPS] for s in squares]
+    border = [sum(1 << d for d in range(len(STEPS)) if step[s][d] == NO_SQUARE) for s in squares]
+    codes = [name for name, _, _ in STEPS]
+    edge_square = [[dx * size + dy for dx, dy, _ in o] for o in WALL_EDGES]
+    edge_step = [[codes.index(name) for _, _, name in o] for o in WALL_EDGES]
+    return row, column, step, jump, border, edge_square, edge_step
+
+
+def array(values, width):
+    lines = []
+    for i in range(0, len(values), width):
+        lines.append("\t" + ", ".join(values[i:i + width]) + ",")
+    lines[-1] = lines[-1].rstrip(",")
+    return lines
+
+
+def emit(src, size):
+    row, column, step, jump, border, edge_square, edge_step = tables(size)
+    squares = size * size
+    desc = ["GENERATED by tools/boardtables.py, do not edit. Neighbours, jump squares,",
+            "border and wall sides of the %d squares of the board" % squares]
+
+    h = header("boardtables.h", desc, "boardtables.c, quoridor.c")
+    h += ["#ifndef __BOARDTABLES_H",
+          "#define __BOARDTABLES_H",
+          "",
+          "/* Includes ------------------------------------------------------------------*/",
+          "#include <stdint.h>",
+          "",
+          "/* Private define ------------------------------------------------------------*/",
+          "#define BOARD_SQUARES   %d" % squares,
+          "#define SQUARE(x, y)    ((x) * %d + (y))" % size,
+          "#define NO_SQUARE       0x%02X" % NO_SQUARE,
+          ""]
+    h += ["#define %-15s %d" % ("STEP_" + name, d) for d, (name, _, _) in enumerate(STEPS)]
+    h += ["#define STEPS           %d" % len(STEPS),
+          "#define STEP_BIT(step)  (1 << (step))",
+          "",
+          "/* Private variables ---------------------------------------------------------*/",
+          "extern const uint8_t squareRow[BOARD_SQUARES];",
+          "extern const uint8_t squareColumn[BOARD_SQUARES];",
+          "extern const uint8_t squareStep[BOARD_SQUARES][STEPS];     /* NO_SQUARE: off the board */",
+          "extern const uint8_t squareJump[BOARD_SQUARES][STEPS];     /* NO_SQUARE: off the board */",
+          "extern const uint8_t squareBorder[BOARD_SQUARES];          /* STEP_BIT of the steps off the board */",
+          "extern const int8_t wallEdgeSquare[2][4];                  /* by orientation, from the wall square */",
+          "extern const uint8_t wallEdgeStep[2][4];",
+          "",
+          "#endif /* end __BOARDTABLES_H */",
+          "/*****************************************************************************",
+          "**                            End Of File",
+          "******************************************************************************/"]
+
+    c = header("boardtables.c", desc, "boardtables.h, quoridor.c")
+    c += ['#include "boardtables.h"',
+          "",
+          "const uint8_t squareRow[BOARD_SQUARES] = {"]
+    c += array(["%d" % v for v in row], size)
+    c += ["};", "", "const uint8_t squareColumn[BOARD_SQUARES] = {"]
+    c += array(["%d" % v for v in column], size)
+    c += ["};", "", "const uint8_t squareStep[BOARD_SQUARES][STEPS] = {"]
+    c += array(["{%s}" % ",".join("%3d" % v for v in s) for s in step], size)
+    c += ["};", "", "const uint8_t squareJump[BOARD_SQUARES][STEPS] = {"]
+    c += array(["{%s}" % ",".join("%3d" % v for v in s) for s in jump], size)
+    c += ["};", "", "const uint8_t squareBorder[BOARD_SQUARES] = {"]
+    c += array(["0x%X" % v for v in border], size)
+    c += ["};", "", "const int8_t wallEdgeSquare[2][4] = {"]
+    c += array(["{%s}" % ", ".join("%d" % v for v in o) for o in edge_square], 1)
+    c += ["};", "", "const uint8_t wallEdgeStep[2][4] = {"]
+    c += array(["{%s}" % ", ".join("STEP_%s" % STEPS[v][0] for v in o) for o in edge_step], 1)
+    c += ["};",
+          "",
+          "/******************************************************************************",
+          "**                            End Of File",
+          "******************************************************************************/"]
+
+    changed = write(os.path.join(src, 'boardtables.h'), h)
+    changed = write(os.path.join(src, 'boardtables.c'), c) or changed
+    return changed
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Writes boardtables.c/.h, the board lookup tables.")
+    parser.add_argument('--src', default='.', help="firmware source directory (default: current)")
+    args = parser.parse_args()
+
+    size = evaluate(parse_defines(read(os.path.join(args.src, 'quoridor.c'))), 'BOARD_SIZE')
+    changed = emit(args.src, size)
+    print("boardtables.c: %d squares%s" % (size * size, "" if changed else ", unchanged"))
+
+
+if __name__ == '__main__':
+    main()
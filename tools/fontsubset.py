@@ -0,0 +1,366 @@
+#!/usr/bin/env python3
+"""Font subsetter for the GLCD driver.
+
+Scans the string and character literals of the game sources and writes
+GLCD/FontSubset.c, which holds only the glyphs those literals can put on
+the screen:
+
+  - the 8x16 ASCII glyphs of AsciiLib.c (font selected in AsciiLib.h);
+  - the 16x16 GB2312 glyphs of HzLib.c.
+
+FontSubset.c provides GetASCIICode() and GetGBKCode() and replaces
+AsciiLib.c and HzLib.c in the Keil project; those two files stay in the tree
+as the glyph source of this script. A character missing from the subset is
+drawn blank.
+
+Numbers printed at run time are covered by the conversions of the format
+strings: %d/%i/%u add the decimal digits and '-', %x/%X the hex digits.
+The arguments of printf and puts are skipped: they go to the Debug (printf)
+Viewer or the UART, never to the LCD. sprintf is scanned, its buffer is
+what the game draws. Extra characters can be forced with --keep.
+
+Run from the src directory (it is the "Before Build" user command of
+sample.uvprojx), or pass --src:
+
+    python ../tools/fontsubset.py
+    python tools/fontsubset.py --src src --keep "?"
+"""
+
+import argparse
+import os
+import re
+import sys
+
+# Sources drawn on the LCD: the game, the interrupt handlers and main.
+# GLCD (driver printf), CMSIS and startup files are not scanned.
+DEFAULT_SOURCES = [
+    "sample.c",
+    "quoridor.c",
+    "RIT/IRQ_RIT.c",
+    "timer/IRQ_timer.c",
+    "button_EXINT/IRQ_button.c",
+    "joystick/lib_joystick.c",
+]
+
+ASCII_FIRST = 0x20
+ASCII_COUNT = 95
+HZ_FIRST = 0xB0          # HzLib.c starts at the first level-1 hanzi
+HZ_ROW = 94
+HZ_GLYPHS = 6768
+ABSENT = 0xFF
+
+LITERAL = re.compile(r'"((?:[^"\\\n]|\\.)*)"|\'((?:[^\'\\\n]|\\.)+)\'')
+COMMENT = re.compile(rb'/\*.*?\*/|//[^\n]*', re.S)
+ASM = re.compile(rb'__(?:ASM|asm)\s*(?:volatile\s*)?\(\s*"(?:[^"\\]|\\.)*"\s*\)')
+CONVERSION = re.compile(r'%[-+ #0]*\d*(?:\.\d+)?[hlLqjzt]*([diouxXcsp%])')
+ROW = re.compile(r'\{\s*((?:0x[0-9A-Fa-f]{2}\s*,\s*){15}0x[0-9A-Fa-f]{2})\s*\}')
+
+# Calls whose literals never reach the LCD
+CONSOLE_CALL = re.compile(r'\b(?:printf|puts)\s*\(')
+
+ESCAPES = {'n': '\n', 't': '\t', 'r': '\r', '0': '\0', '\\': '\\', '"': '"', "'": "'"}
+
+
+def unescape(text):
+    """Decode the C escapes of a literal to a byte string (latin-1 code points)."""
+    out = []
+    i = 0
+    while i < len(text):
+        c = text[i]
+        if c == '\\' and i + 1 < len(text):
+            e = text[i + 1]
+            if e == 'x':
+                m = re.match(r'[0-9A-Fa-f]{1,2}', text[i + 2:])
+                out.append(chr(int(m.group(0), 16)))
+                i += 2 + len(m.group(0))
+                continue
+            if e in '01234567':
+                m = re.match(r'[0-7]{1,3}', text[i + 1:])
+                out.append(chr(int(m.group(0), 8)))
+                i += 1 + len(m.group(0))
+                continue
+            out.append(ESCAPES.get(e, e))
+            i += 2
+            continue
+        out.append(c)
+        i += 1
+    return ''.join(out)
+
+
+def strip_console(text):
+    """Blanks the argument lists of the CONSOLE_CALL calls of text."""
+    out = []
+    pos = 0
+    for m in CONSOLE_CALL.finditer(text):
+        if m.start() < pos:
+            continue
+        i = m.end()
+        depth = 1
+        while i < len(text) and depth:
+            c = text[i]
+            if c in '"\'':
+                lit = LITERAL.match(text, i)
+                i = lit.end() if lit else i + 1
+                continue
+            depth += {'(': 1, ')': -1}.get(c, 0)
+            i += 1
+        out.append(text[pos:m.end()])
+        pos = i
+    out.append(text[pos:])
+    return ''.join(out)
+
+
+def scan_sources(paths):
+    """Returns (ascii codes, GB2312 codes) reachable from the literals of paths."""
+    ascii_codes = {ord(' ')}
+    hz_codes = set()
+    for path in paths:
+        with open(path, 'rb') as f:
+            data = f.read()
+        data = COMMENT.sub(b' ', data)
+        data = ASM.sub(b' ', data)
+        lines = [l for l in data.split(b'\n') if not l.lstrip().startswith(b'#')]
+        text = strip_console(b'\n'.join(lines).decode('latin-1'))
+        for m in LITERAL.finditer(text):
+            s = unescape(m.group(1) if m.group(1) is not None else m.group(2))
+            for conv in CONVERSION.finditer(s):
+                kind = conv.group(1)
+                if kind in 'diu':
+                    ascii_codes.update(map(ord, '0123456789-'))
+                elif kind in 'xX':
+                    digits = '0123456789abcdef' if kind == 'x' else '0123456789ABCDEF'
+                    ascii_codes.update(map(ord, digits))
+                elif kind == 'o':
+                    ascii_codes.update(map(ord, '01234567'))
+                elif kind in 'cp':
+                    print("%s: '%%%s' prints characters the scan cannot see, use --keep"
+                          % (path, kind), file=sys.stderr)
+            s = CONVERSION.sub('', s)
+            i = 0
+            while i < len(s):
+                c = ord(s[i])
+                if c >= 0xA1 and i + 1 < len(s) and ord(s[i + 1]) >= 0xA1:
+                    hz_codes.add((c << 8) | ord(s[i + 1]))
+                    i += 2
+                    continue
+                if ASCII_FIRST <= c < ASCII_FIRST + ASCII_COUNT:
+                    ascii_codes.add(c)
+                i += 1
+    return ascii_codes, hz_codes
+
+
+def selected_font(glcd):
+    """Name of the ASCII font enabled in AsciiLib.h."""
+    with open(os.path.join(glcd, 'AsciiLib.h'), 'rb') as f:
+        for line in f.read().decode('latin-1').splitlines():
+            m = re.match(r'\s*#define\s+(ASCII_8X16_\w+)', line)
+            if m:
+                return m.group(1)
+    sys.exit("AsciiLib.h: no ASCII_8X16_* font selected")
+
+
+def read_rows(text):
+    return [[int(b, 16) for b in m.group(1).replace(' ', '').split(',')]
+            for m in ROW.finditer(text)]
+
+
+def load_ascii(glcd, font):
+    with open(os.path.join(glcd, 'AsciiLib.c'), 'rb') as f:
+        text = f.read().decode('latin-1')
+    m = re.search(r'#ifdef\s+%s\b(.*?)#endif' % font, text, re.S)
+    if not m:
+        sys.exit("AsciiLib.c: font %s not found" % font)
+    rows = read_rows(m.group(1))
+    if len(rows) != ASCII_COUNT:
+        sys.exit("AsciiLib.c: %d glyphs in %s, %d expected" % (len(rows), font, ASCII_COUNT))
+    return rows
+
+
+def load_hz(glcd):
+    with open(os.path.join(glcd, 'HzLib.c'), 'rb') as f:
+        text = f.read().decode('latin-1')
+    rows = read_rows(text)
+    return [rows[i] + rows[i + 1] for i in range(0, len(rows) - 1, 2)]
+
+
+def hz_index(code):
+    high, low = code >> 8, code & 0xFF
+    return (high - HZ_FIRST) * HZ_ROW + low - 0xA1
+
+
+def hex_row(data):
+    return ','.join('0x%02X' % b for b in data)
+
+
+def ascii_name(code):
+    c = chr(code)
+    return {'\\': 'backslash', '*': 'asterisk', '/': 'slash'}.get(c, c)
+
+
+def emit(out_path, font, ascii_codes, ascii_rows, hz_codes, hz_rows, sources):
+    ascii_list = sorted(ascii_codes)
+    hz_list = sorted(hz_codes)
+    index = [ABSENT] * ASCII_COUNT
+    for n, code in enumerate(ascii_list):
+        index[code - ASCII_FIRST] = n
+
+    L = []
+    L.append("/*********************************************************************************************************")
+    L.append("**--------------File Info---------------------------------------------------------------------------------")
+    L.append("** File name:           FontSubset.c")
+    L.append("** Descriptions:        GENERATED by tools/fontsubset.py, do not edit. Glyphs of AsciiLib.c (%s)" % font)
+    L.append("**                      and HzLib.c used by the literals of: %s" % ' '.join(sources[:3]))
+    for i in range(3, len(sources), 3):
+        L.append("**                      %s" % ' '.join(sources[i:i + 3]))
+    L.append("**                      %d of %d ASCII glyphs, %d of %d GB2312 glyphs"
+             % (len(ascii_list), ASCII_COUNT, len(hz_list), HZ_GLYPHS))
+    L.append("** Correlated files:    AsciiLib.h, HzLib.h, GLCD.c")
+    L.append("**--------------------------------------------------------------------------------------------------------")
+    L.append("*********************************************************************************************************/")
+    L.append("")
+    L.append("/* Includes ------------------------------------------------------------------*/")
+    L.append('#include "AsciiLib.h"')
+    L.append('#include "HzLib.h"')
+    L.append("")
+    L.append("/* Private define ------------------------------------------------------------*/")
+    L.append("#define ASCII_GLYPHS    %d" % len(ascii_list))
+    L.append("#define HZ_GLYPHS       %d" % len(hz_list))
+    L.append("#define GLYPH_ABSENT    0x%02X" % ABSENT)
+    L.append("")
+    L.append("/* Private variables ---------------------------------------------------------*/")
+    L.append("/* glyph of each printable character (' ' to '~'), GLYPH_ABSENT if not used */")
+    L.append("static unsigned char const AsciiIndex[%d] = {" % ASCII_COUNT)
+    for i in range(0, ASCII_COUNT, 16):
+        L.append("\t" + ','.join('0x%02X' % v for v in index[i:i + 16]) + ',')
+    L[-1] = L[-1].rstrip(',')
+    L.append("};")
+    L.append("")
+    L.append("static unsigned char const AsciiGlyph[ASCII_GLYPHS][16] = {")
+    for code in ascii_list:
+        L.append('{%s},/*"%s",%d*/' % (hex_row(ascii_rows[code - ASCII_FIRST]), ascii_name(code),
+                                      code - ASCII_FIRST))
+    L.append("};")
+    L.append("")
+    if hz_list:
+        L.append("/* GB2312 codes of the glyphs below, ascending */")
+        L.append("static unsigned short const HzCode[HZ_GLYPHS] = {")
+        for i in range(0, len(hz_list), 8):
+            L.append("\t" + ','.join('0x%04X' % c for c in hz_list[i:i + 8]) + ',')
+        L[-1] = L[-1].rstrip(',')
+        L.append("};")
+        L.append("")
+        L.append("static unsigned char const HzGlyph[HZ_GLYPHS][32] = {")
+        for code in hz_list:
+            L.append("{%s},/*0x%04X,%d*/" % (hex_row(hz_rows[hz_index(code)]), code, hz_index(code)))
+        L.append("};")
+        L.append("")
+    L.append("/*******************************************************************************")
+    L.append("* Function Name  : GetASCIICode")
+    L.append("* Description    : Copies the 8x16 glyph of a character.")
+    L.append("* Input          : - ASCII: character code")
+    L.append("* Output         : - *pBuffer: 16 bytes, one per row")
+    L.append("* Return         : None")
+    L.append("* Attention\t\t : A character not in the subset is returned blank")
+    L.append("*******************************************************************************/")
+    L.append("void GetASCIICode(unsigned char* pBuffer,unsigned char ASCII)")
+    L.append("{")
+    L.append("   unsigned char glyph = GLYPH_ABSENT;")
+    L.append("")
+    L.append("   if( ASCII >= 0x%02X && ASCII < 0x%02X )" % (ASCII_FIRST, ASCII_FIRST + ASCII_COUNT))
+    L.append("   {")
+    L.append("      glyph = AsciiIndex[ASCII - 0x%02X];" % ASCII_FIRST)
+    L.append("   }")
+    L.append("   if( glyph == GLYPH_ABSENT )")
+    L.append("   {")
+    L.append("      memset(pBuffer,0,16);")
+    L.append("      return;")
+    L.append("   }")
+    L.append("   memcpy(pBuffer,AsciiGlyph[glyph],16);")
+    L.append("}")
+    L.append("")
+    L.append("/*******************************************************************************")
+    L.append("* Function Name  : GetGBKCode")
+    L.append("* Description    : Copies the 16x16 glyph of a GB2312 character.")
+    L.append("* Input          : - *c: the two bytes of the character code")
+    L.append("* Output         : - *pBuffer: 32 bytes, two per row")
+    L.append("* Return         : None")
+    L.append("* Attention\t\t : A character not in the subset is returned blank")
+    L.append("*******************************************************************************/")
+    L.append("void GetGBKCode(unsigned char* pBuffer,unsigned char * c)")
+    L.append("{")
+    if hz_list:
+        L.append("   unsigned short code = (c[0] << 8) | c[1];")
+        L.append("   int low = 0, high = HZ_GLYPHS - 1, mid;")
+        L.append("")
+        L.append("   while( low <= high )")
+        L.append("   {")
+        L.append("      mid = (low + high) / 2;")
+        L.append("      if( HzCode[mid] == code )")
+        L.append("      {")
+        L.append("         memcpy(pBuffer,HzGlyph[mid],32);")
+        L.append("         return;")
+        L.append("      }")
+        L.append("      if( HzCode[mid] < code )")
+        L.append("      {")
+        L.append("         low = mid + 1;")
+        L.append("      }")
+        L.append("      else")
+        L.append("      {")
+        L.append("         high = mid - 1;")
+        L.append("      }")
+        L.append("   }")
+        L.append("   memset(pBuffer,0,32);")
+    else:
+        L.append("   (void)c;                          /* no GB2312 text is drawn */")
+        L.append("   memset(pBuffer,0,32);")
+    L.append("}")
+    L.append("")
+    L.append("/*********************************************************************************************************")
+    L.append("      END FILE")
+    L.append("*********************************************************************************************************/")
+
+    data = '\r\n'.join(L) + '\r\n'
+    try:
+        with open(out_path, 'rb') as f:
+            if f.read() == data.encode('latin-1'):
+                return False
+    except IOError:
+        pass
+    with open(out_path, 'wb') as f:
+        f.write(data.encode('latin-1'))
+    return True
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Writes GLCD/FontSubset.c with the glyphs the game draws.")
+    parser.add_argument('--src', default='.', help="firmware source directory (default: current)")
+    parser.add_argument('--keep', default='', help="extra ASCII characters to keep")
+    parser.add_argument('sources', nargs='*', help="sources to scan, relative to --src")
+    args = parser.parse_args()
+
+    sources = args.sources or DEFAULT_SOURCES
+    glcd = os.path.join(args.src, 'GLCD')
+    font = selected_font(glcd)
+
+    ascii_codes, hz_codes = scan_sources([os.path.join(args.src, s) for s in sources])
+    for c in args.keep:
+        if ASCII_FIRST <= ord(c) < ASCII_FIRST + ASCII_COUNT:
+            ascii_codes.add(ord(c))
+
+    hz_rows = load_hz(glcd) if hz_codes else []
+    for code in sorted(hz_codes):
+        if code >> 8 < HZ_FIRST or hz_index(code) >= len(hz_rows):
+            print("GB2312 0x%04X is not in HzLib.c, drawn blank" % code, file=sys.stderr)
+            hz_codes.discard(code)
+
+    out = os.path.join(glcd, 'FontSubset.c')
+    changed = emit(out, font, ascii_codes, load_ascii(glcd, font), hz_codes, hz_rows,
+                   [s.replace(os.sep, '/') for s in sources])
+    print("%s: %d ASCII, %d GB2312 glyphs (%d bytes)%s"
+          % (out, len(ascii_codes), len(hz_codes),
+             ASCII_COUNT + 16 * len(ascii_codes) + 34 * len(hz_codes),
+             "" if changed else ", unchanged"))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,238 @@
+#!/usr/bin/env python3
+"""Start screen generator.
+
+Renders the static start screen of the game (Sand background, 7x7 board,
+the two tokens on their start squares, the three sections with their labels)
+exactly as the drawing functions of quoridor.c would, and writes it as a
+run-length encoded RGB565 stream for LCD_DrawRLE:
+
+    startscreen.h   size, run count and declarations
+    startscreen.c   palette and runs (LCD_RLE_RUN words, row by row)
+
+Geometry is read from the #defines of quoridor.c, the token shape from its
+tokenSpan table, the labels from its startLabel table, the colours from
+GLCD.h and the glyphs from the ASCII font selected in AsciiLib.h. Rerun the
+script after changing any of them, or the layout in initQuoridor:
+
+    python ../tools/startscreen.py            (from src)
+    python tools/startscreen.py --src src
+"""
+
+import argparse
+import os
+import re
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from fontsubset import ASCII_FIRST, load_ascii, selected_font  # noqa: E402
+
+WIDTH, HEIGHT = 240, 320        # MAX_X, MAX_Y for DISP_ORIENTATION 0
+MAX_RUN = 4096                  # LCD_RLE_MAX_RUN
+MAX_COLORS = 16                 # LCD_RLE_COLORS
+
+# Start squares of the tokens [row, column], as set by initQuoridor
+TOKENS = [(6, 3, 'White'), (0, 3, 'Red')]
+
+
+def read(path):
+    with open(path, 'rb') as f:
+        data = f.read().decode('latin-1')
+    return re.sub(r'/\*.*?\*/|//[^\n]*', ' ', data, flags=re.S)
+
+
+def parse_defines(text):
+    return dict((m.group(1), m.group(2)) for m in
+                re.finditer(r'^\s*#define\s+(\w+)\s+(\S+)', text, re.M))
+
+
+def evaluate(defines, name):
+    expr = defines[name]
+    for _ in range(8):
+        expr = re.sub(r'[A-Za-z_]\w*', lambda m: '(%s)' % defines.get(m.group(0), m.group(0)), expr)
+    return int(eval(expr.replace('/', '//'), {}))
+
+
+def parse_span(text):
+    m = re.search(r'tokenSpan\s*\[[^\]]*\]\s*=\s*\{([^}]*)\}', text)
+    if not m:
+        sys.exit("quoridor.c: tokenSpan not found")
+    return [int(v) for v in m.group(1).split(',')]
+
+
+def parse_labels(text):
+    m = re.search(r'startLabel\s*\[[^\]]*\]\s*=\s*\{(.*?)\};', text, re.S)
+    if not m:
+        sys.exit("quoridor.c: startLabel not found")
+    return [(int(r), int(l), c, s) for r, l, c, s in
+            re.findall(r'\{\s*(\d+)\s*,\s*(\d+)\s*,\s*(\w+)\s*,\s*"([^"]*)"\s*\}', m.group(1))]
+
+
+class Screen(object):
+    def __init__(self, color):
+        self.pixels = [[color] * WIDTH for _ in range(HEIGHT)]
+
+    def fill(self, x, y, w, h, color):
+        """LCD_FillRect: x is the column, y the row."""
+        for row in range(max(y, 0), min(y + h, HEIGHT)):
+            for col in range(max(x, 0), min(x + w, WIDTH)):
+                self.pixels[row][col] = color
+
+    def text(self, x, y, s, glyphs, color, bk):
+        """GUI_TextSlot on a fresh slot: one 8x16 PutChar per character."""
+        for i, ch in enumerate(s):
+            rows = glyphs[ord(ch) - ASCII_FIRST]
+            for r in range(16):
+                for c in range(8):
+                    on = (rows[r] >> (7 - c)) & 1
+                    self.pixels[y + r][x + 8 * i + c] = color if on else bk
+
+
+def render(src):
+    glcd_h = parse_defines(read(os.path.join(src, 'GLCD', 'GLCD.h')))
+    colors = dict((k, int(v, 16)) for k, v in glcd_h.items() if re.match(r'0x[0-9A-Fa-f]{4}$', v))
+    q = read(os.path.join(src, 'quoridor.c'))
+    d = parse_defines(q)
+    board = evaluate(d, 'BOARD_SIZE')
+    square = evaluate(d, 'SQUARE_SIZE')
+    space = evaluate(d, 'SPACE_BETWEEN')
+    rect_w = evaluate(d, 'RECTANGLE_WIDTH')
+    rect_h = evaluate(d, 'RECTANGLE_HEIGHT')
+    span = parse_span(q)
+    radius = len(span) - 1
+    glyphs = load_ascii(os.path.join(src, 'GLCD'), selected_font(os.path.join(src, 'GLCD')))
+    sand = colors['Sand']
+    step = square + space
+
+    screen = Screen(sand)                                   # LCD_Clear(Sand)
+    for i in range(board):                                  # drawBoard
+        for j in range(board):
+            screen.fill(10 + i * step, 10 + j * step, square, square, colors['Black'])
+    for row, col, color in TOKENS:                          # drawCircle
+        cx = row * step + 10 + square // 2
+        cy = col * step + 10 + square // 2
+        for dy in range(-radius, radius + 1):
+            half = span[abs(dy)]
+            screen.fill(cy - half, cx + dy, 2 * half + 1, 1, colors[color])
+    top = board * step + 40
+    for n in range(3):                                      # drawRectangleWithText borders
+        x = 10 + n * (rect_w + space)
+        screen.fill(x, top, rect_w, 1, colors['Black'])
+        screen.fill(x, top + rect_h - 1, rect_w, 1, colors['Black'])
+        screen.fill(x, top, 1, rect_h, colors['Black'])
+        screen.fill(x + rect_w - 1, top, 1, rect_h, colors['Black'])
+    for rect, line, color, s in parse_labels(q):            # updateRectangleText
+        x = 10 + rect * (rect_w + space) + 5
+        y = top + (20 if line else 0) + 5
+        screen.text(x, y, s, glyphs, colors[color], sand)
+    return screen, colors
+
+
+def encode(screen):
+    palette = []
+    runs = []
+    current, length = None, 0
+    for row in screen.pixels:
+        for p in row:
+            if p == current and length < MAX_RUN:
+                length += 1
+                continue
+            if current is not None:
+                runs.append((palette.index(current), length))
+            if p not in palette:
+                palette.append(p)
+            current, length = p, 1
+    runs.append((palette.index(current), length))
+    if len(palette) > MAX_COLORS:
+        sys.exit("start screen: %d colours, at most %d" % (len(palette), MAX_COLORS))
+    return palette, runs
+
+
+def header(name, desc, correlated):
+    return ["/*********************************************************************************************************",
+            "**--------------File Info---------------------------------------------------------------------------------",
+            "** File name:           %s" % name,
+            "** Descriptions:        %s" % desc[0]] + \
+           ["**                      %s" % l for l in desc[1:]] + \
+           ["** Correlated files:    %s" % correlated,
+            "**--------------------------------------------------------------------------------------------------------",
+            "*********************************************************************************************************/"]
+
+
+def write(path, lines):
+    data = ('\r\n'.join(lines) + '\r\n').encode('latin-1')
+    try:
+        with open(path, 'rb') as f:
+            if f.read() == data:
+                return False
+    except IOError:
+        pass
+    with open(path, 'wb') as f:
+        f.write(data)
+    return True
+
+
+def emit(src, palette, runs, colors):
+    names = dict((v, k) for k, v in sorted(colors.items(), reverse=True))
+    desc = ["GENERATED by tools/startscreen.py, do not edit. Start screen of the game,",
+            "run-length encoded for LCD_DrawRLE (%d runs, %d bytes)" % (len(runs), 2 * len(runs))]
+
+    h = header("startscreen.h", desc, "startscreen.c, quoridor.c")
+    h += ["#ifndef __STARTSCREEN_H",
+          "#define __STARTSCREEN_H",
+          "",
+          "/* Includes ------------------------------------------------------------------*/",
+          "#include <stdint.h>",
+          "",
+          "/* Private define ------------------------------------------------------------*/",
+          "#define START_SCREEN_WIDTH    %d" % WIDTH,
+          "#define START_SCREEN_HEIGHT   %d" % HEIGHT,
+          "#define START_SCREEN_COLORS   %d" % len(palette),
+          "#define START_SCREEN_RUNS     %d" % len(runs),
+          "",
+          "/* Private variables ---------------------------------------------------------*/",
+          "extern const uint16_t startScreenPalette[START_SCREEN_COLORS];",
+          "extern const uint16_t startScreenRuns[START_SCREEN_RUNS];",
+          "",
+          "#endif /* end __STARTSCREEN_H */",
+          "/*****************************************************************************",
+          "**                            End Of File",
+          "******************************************************************************/"]
+
+    c = header("startscreen.c", desc, "startscreen.h, quoridor.c")
+    c += ['#include "GLCD/GLCD.h"',
+          '#include "startscreen.h"',
+          "",
+          "const uint16_t startScreenPalette[START_SCREEN_COLORS] = {",
+          "\t" + ", ".join(names.get(p, "0x%04X" % p) for p in palette),
+          "};",
+          "",
+          "const uint16_t startScreenRuns[START_SCREEN_RUNS] = {"]
+    words = ["LCD_RLE_RUN(%d,%d)" % r for r in runs]
+    for i in range(0, len(words), 8):
+        c.append("\t" + ",".join(words[i:i + 8]) + ",")
+    c[-1] = c[-1].rstrip(",")
+    c += ["};",
+          "",
+          "/******************************************************************************",
+          "**                            End Of File",
+          "******************************************************************************/"]
+
+    changed = write(os.path.join(src, 'startscreen.h'), h)
+    changed = write(os.path.join(src, 'startscreen.c'), c) or changed
+    return changed
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Writes startscreen.c/.h, the RLE start screen.")
+    parser.add_argument('--src', default='.', help="firmware source directory (default: current)")
+    args = parser.parse_args()
+
+    screen, colors = render(args.src)
+    palette, runs = encode(screen)
+    changed = emit(args.src, palette, runs, colors)
+    print("startscreen.c: %d colours, %d runs (%d bytes)%s"
+          % (len(palette), len(runs), 2 * len(runs), "" if changed else ", unchanged"))
+
+
+if __name__ == '__main__':
+    main()